@@ -13,7 +13,6 @@
 #include <WiFi.h>
 #include <NetBIOS.h>
 #include <ESPmDNS.h>
-#include <SPIFFS.h>
 #include <StringArray.h>
 #include <ESPAsyncWebServer.h>
 #include <Preferences.h>
@@ -21,6 +20,7 @@
 #include <esp_wifi.h>
 #include <nvs_flash.h>
 #include <rom/rtc.h>
+#include <new>
 
 #include "src/Settings.h"
 #include "src/ApInfo.h"
@@ -28,6 +28,29 @@
 #include "src/ApSettings.h"
 #include "src/ServerInfo.h"
 #include "src/SystemInfo.h"
+#include "src/MemoryInfo.h"
+#include "src/TaskInfo.h"
+#include "src/LoopMonitor.h"
+#include "src/Diagnostics.h"
+#include "src/AdmissionControl.h"
+#include "src/RateLimiter.h"
+#include "src/Telemetry.h"
+#include "src/ArenaPool.h"
+#include "src/ContentFormat.h"
+#include "src/OtaUpdate.h"
+#include "src/FileSystem.h"
+#include "src/CommandQueue.h"
+#include "src/SmartConfig.h"
+#include "src/Reconfiguration.h"
+#include "src/WiFiSupervisor.h"
+#include "src/WiFiNetworks.h"
+#include "src/WiFiSelector.h"
+#include "src/Fleet.h"
+#include "src/FleetUdp.h"
+#include "src/FleetInfo.h"
+#include "src/Leaderboard.h"
+#include "src/Templates.h"
+#include "src/TemplateRenderer.h"
 
 // Set the software version for the SystemInfoClass.
 char* SystemInfoClass::SOFTWARE_VERSION = "V1.2.6 2019-12-07";
@@ -36,6 +59,9 @@ char* SystemInfoClass::SOFTWARE_VERSION = "V1.2.6 2019-12-07";
 auto HEADER = "KNOBLOMAT - a DTV classic since the 1970s";
 auto COPYRIGHT = "Copyright (c) 2019 - Dr. Peter Trimmel";
 
+// The script and style bundles (see tools/bundle.py) are referenced with a content hash and never change.
+auto BUNDLE_CACHE_CONTROL = "public, max-age=31536000, immutable";
+
 // Watchdog timer - 10 minute timer
 Neotimer timer = Neotimer(10 * 60 * 1000); 
 
@@ -45,13 +71,74 @@ JLed led = JLed(LED_BUILTIN).Blink(1000, 1000).Forever();
 // The global application settings.
 SettingsClass settings;
 
+// The top players (ranked by win rate).
+LeaderboardClass leaderboard;
+
 // Create Webserver at the default port.
 AsyncWebServer server(ServerInfoClass::PORT);
 
-// Flag indicating that a smart config is about to be performed.
+// The file system backend (SPIFFS or LittleFS, see FileSystem.h).
+FileSystemClass filesystem;
+
+// Admission control for file responses (bounded concurrency and load shedding).
+AdmissionControlClass admission;
+
+// Per client rate limiting of the mutating requests (token buckets).
+RateLimiterClass limiter;
+
+// The main loop timing (period and check function durations).
+LoopMonitorClass monitor;
+
+// The reset reasons and uptimes of the last boots (RTC memory and non volatile storage).
+DiagnosticsClass diagnostics;
+
+// Background sampler for the WiFi and heap data (copied by the handlers under a short critical section).
+TelemetryClass telemetry;
+
+// Streamed firmware and file system updates (with rollback of unconfirmed firmware).
+OtaUpdateClass ota;
+
+// The fixed memory blocks of the JSON handlers and the queued command bodies (no heap allocation).
+ArenaPoolClass arenas;
+
+// The commands pushed by the HTTP handlers and executed by the main task (loop).
+CommandQueueClass commands(arenas);
+
+// The compiled page templates (rendering state in an arena block, page file counted by the admission control).
+TemplateRendererClass renderer(admission, arenas);
+
+// The SmartConfig provisioning (advanced by the main task).
+SmartConfigClass smart;
+
+// The live reconfiguration of the access point and the WiFi station (main task only).
+ReconfigurationClass reconfiguration;
+
+// The WiFi station reconnect supervisor (advanced by the main task).
+WiFiSupervisorClass supervisor;
+
+// The additional WiFi networks (besides the WiFiSettings network).
+WiFiNetworksClass networks;
+
+// The WiFi network selection (scan, rank and connect, advanced by the main task).
+WiFiSelectorClass selector;
+
+// The fleet gossip (game totals shared with the other Knoblomats over UDP multicast).
+UdpFleetTransport fleetTransport;
+FleetClass fleet;
+
+// The request currently streaming an update.
+AsyncWebServerRequest* updater = NULL;
+
+// The body capacity of the queued commands (settings or networks).
+const int COMMAND_CAPACITY = (SettingsClass::CAPACITY > WiFiNetworksClass::CAPACITY) ? SettingsClass::CAPACITY : WiFiNetworksClass::CAPACITY;
+
+// Flag indicating that a file system benchmark is about to be performed (main task only).
+bool benchmark = false;
+
+// Flag indicating that a smart config is about to be performed (main task only).
 bool smartconfig = false;
 
-// Flag indicating that a reboot is about to be performed.
+// Flag indicating that a reboot is about to be performed (main task only).
 bool reboot = false;
 
 // Flag indicating that a WiFi connection to an access point is OK.
@@ -101,130 +188,94 @@ bool wait4WiFi(int count = 20)
 }
 
 /// <summary>
-/// Try to run ESP SmartConfig.
-/// After every try wait for 500 msec.
+/// Start connecting to a WiFi network (the connector of the network selection).
+/// The static address of the WiFiSettings is only used for the primary network, all others use DHCP.
 /// </summary>
-/// <param name="count">The number of tries</param>
-/// <returns>True if sucessful</returns>
-bool wait4Done(int count = 120)
+/// <param name="network">The network credentials</param>
+/// <param name="primary">True for the WiFiSettings network</param>
+/// <returns>True if the connection has been started</returns>
+bool beginWiFi(const WiFiNetwork& network, bool primary)
 {
-	//Wait for SmartConfig packet from mobile
-	Serial.println("Waiting for SmartConfig.");
+	// Reconnecting is left to the supervisor (see checkWiFi).
+	WiFi.setAutoReconnect(false);
+	WiFi.setHostname(settings.WiFiSettings.Hostname.c_str());
 
-	while (!WiFi.smartConfigDone() && (--count > 0)) {
-		delay(500);
-		Serial.print(".");
+	// Trying to connect to WiFi network using the stored settings.
+	Serial.print("Attempting to connect to WiFi network, SSID: ");
+	Serial.println(network.SSID.c_str());
+
+	if (!primary || settings.WiFiSettings.DHCP)
+	{
+		// Enable the DHCP client (a static address may have been configured before).
+		WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
 	}
-	Serial.println("");
+	else
+	{
+		IPAddress address;
+		IPAddress gateway;
+		IPAddress subnet;
+		IPAddress dns1;
+		IPAddress dns2;
+
+		bool addressOK = address.fromString(settings.WiFiSettings.Address.c_str());
+		bool gatewayOK = gateway.fromString(settings.WiFiSettings.Gateway.c_str());
+		bool subnetOK = subnet.fromString(settings.WiFiSettings.Subnet.c_str());
+		bool dns1OK = dns1.fromString(settings.WiFiSettings.DNS1.c_str());
+		bool dns2OK = dns2.fromString(settings.WiFiSettings.DNS2.c_str());
+
+		if (!addressOK || !gatewayOK || !subnetOK)
+		{
+			return false;
+		}
 
-	return WiFi.smartConfigDone();
+		if (dns1OK && dns2OK)
+		{
+			WiFi.config(address, gateway, subnet, dns1, dns2);
+		}
+		else if (dns1OK)
+		{
+			WiFi.config(address, gateway, subnet, dns1);
+		}
+		else
+		{
+			WiFi.config(address, gateway, subnet);
+		}
+	}
+
+	// Using WiFi passphrase to connect (or connect to the open WiFi network).
+	if (network.PASS != "")
+	{
+		WiFi.begin(network.SSID.c_str(), network.PASS.c_str());
+	}
+	else
+	{
+		WiFi.begin(network.SSID.c_str());
+	}
+
+	return true;
 }
 
 /// <summary>
-/// Try to connect to WiFi network using the WiFiSettings.
+/// Try to connect to one of the known WiFi networks (blocking, see WiFiSelectorClass).
 /// </summary>
 void connectWiFi(void)
 {
 	wifiOK = false;
-	WiFi.setAutoReconnect(true);
-	WiFi.setHostname(settings.WiFiSettings.Hostname.c_str());
 
-	// Check if WiFi network SSID is availabel and try to connect.
-	if (settings.WiFiSettings.SSID != "")
+	if (selector.start())
 	{
-		// Trying to connect to WiFi network using the stored settings.
-		Serial.print("Attempting to connect to WiFi network, SSID: ");
-		Serial.println(settings.WiFiSettings.SSID);
-
-		// Using WiFi passphrase to connect.
-		if (settings.WiFiSettings.PASS != "")
-		{
-			if (settings.WiFiSettings.DHCP)
-			{
-				// attempt to connect to Wifi network:
-				WiFi.begin(settings.WiFiSettings.SSID.c_str(), settings.WiFiSettings.PASS.c_str());
-				wifiOK = wait4WiFi();
-			}
-			else
-			{
-				IPAddress address;
-				IPAddress gateway;
-				IPAddress subnet;
-				IPAddress dns1;
-				IPAddress dns2;
-
-				bool addressOK = address.fromString(settings.WiFiSettings.Address);
-				bool gatewayOK = gateway.fromString(settings.WiFiSettings.Gateway);
-				bool subnetOK = subnet.fromString(settings.WiFiSettings.Subnet);
-				bool dns1OK = dns1.fromString(settings.WiFiSettings.DNS1);
-				bool dns2OK = dns2.fromString(settings.WiFiSettings.DNS2);
-
-				if (addressOK && gatewayOK && subnetOK)
-				{
-					if (dns1OK && dns2OK)
-					{
-						WiFi.config(address, gateway, subnet, dns1, dns2);
-					}
-					else if (dns1OK)
-					{
-						WiFi.config(address, gateway, subnet, dns1);
-					}
-					else
-					{
-						WiFi.config(address, gateway, subnet);
-					}
-
-					WiFi.begin(settings.WiFiSettings.SSID.c_str(), settings.WiFiSettings.PASS.c_str());
-					wifiOK = wait4WiFi();
-				}
-			}
-		}
-		// Connect to the open WiFi network
-		else
+		while (!selector.update())
 		{
-			if (settings.WiFiSettings.DHCP)
-			{
-				WiFi.begin(settings.WiFiSettings.SSID.c_str());
-				wifiOK = wait4WiFi();
-			}
-			else
-			{
-				IPAddress address;
-				IPAddress gateway;
-				IPAddress subnet;
-				IPAddress dns1;
-				IPAddress dns2;
-
-				bool addressOK = address.fromString(settings.WiFiSettings.Address);
-				bool gatewayOK = gateway.fromString(settings.WiFiSettings.Gateway);
-				bool subnetOK = subnet.fromString(settings.WiFiSettings.Subnet);
-				bool dns1OK = dns1.fromString(settings.WiFiSettings.DNS1);
-				bool dns2OK = dns2.fromString(settings.WiFiSettings.DNS2);
-
-				if (addressOK && gatewayOK && subnetOK)
-				{
-					if (dns1OK && dns2OK)
-					{
-						WiFi.config(address, gateway, subnet, dns1, dns2);
-					}
-					else if (dns1OK)
-					{
-						WiFi.config(address, gateway, subnet, dns1);
-					}
-					else
-					{
-						WiFi.config(address, gateway, subnet);
-					}
-
-					WiFi.begin(settings.WiFiSettings.SSID.c_str());
-					wifiOK = wait4WiFi();
-				}
-			}
+			delay(100);
+			Serial.print(".");
 		}
+		Serial.println("");
+
+		wifiOK = (selector.Status == WiFiSelectorClass::Connected);
 
 		if (wifiOK)
 		{
-			Serial.println("WiFi connection successful");
+			Serial.print("WiFi connection successful in "); Serial.print(selector.ConnectTime); Serial.println(" msec");
 			WiFiInfoClass info(WiFi);
 			info.print();
 		}
@@ -242,14 +293,17 @@ void createAP(void)
 {
 	apOK = false;
 	Serial.print("Creating access point named: ");
-	Serial.println(settings.ApSettings.SSID);
+	Serial.println(settings.ApSettings.SSID.c_str());
 
-	// Check if the default SSID has been set (using the chip ID - MAC address).
+	// Check if the default SSID has been set (using the chip ID - MAC address). An invalid (e.g. newer)
+	// blob has loaded the defaults, it is kept for a later firmware and the SSID is set in memory only.
 	if (settings.ApSettings.SSID == ApSettingsClass::WIFI_SSID_AP) {
-		SystemInfoClass info;
+		settings.ApSettings.SSID.format("%s%s", ApSettingsClass::WIFI_SSID_AP, SystemInfoClass::ChipID);
 
-		settings.ApSettings.SSID = ApSettingsClass::WIFI_SSID_AP + info.ChipID;
-		settings.ApSettings.save();
+		if (strcmp(settings.ApSettings.Source, "Invalid") != 0)
+		{
+			settings.ApSettings.save();
+		}
 	}
 
 	if (settings.ApSettings.Custom)
@@ -258,9 +312,9 @@ void createAP(void)
 		IPAddress gateway;
 		IPAddress subnet;
 
-		bool addressOK = address.fromString(settings.ApSettings.Address);
-		bool gatewayOK = gateway.fromString(settings.ApSettings.Gateway);
-		bool subnetOK = subnet.fromString(settings.ApSettings.Subnet);
+		bool addressOK = address.fromString(settings.ApSettings.Address.c_str());
+		bool gatewayOK = gateway.fromString(settings.ApSettings.Gateway.c_str());
+		bool subnetOK = subnet.fromString(settings.ApSettings.Subnet.c_str());
 
 		WiFi.softAPConfig(address, gateway, subnet);
 	}
@@ -292,7 +346,103 @@ void createAP(void)
 }
 
 /// <summary>
-/// Check if we should start the WiFi SmartConfig.
+/// Apply new access point settings in place. A changed hostname is set directly, other changes
+/// restart the access point (the WiFi station stays connected). The chip is only restarted
+/// if the access point cannot be created with the new settings.
+/// </summary>
+/// <param name="previous">The running access point settings</param>
+void applyAp(const ApSettingsClass& previous)
+{
+	uint32_t changed = settings.ApSettings.changed(previous);
+
+	if (changed == 0)
+	{
+		reconfiguration.start(reconfiguration.Ap, ReconfigureResult::Unchanged, 0);
+		return;
+	}
+
+	settings.ApSettings.save();
+	reconfiguration.start(reconfiguration.Ap, ReconfigureResult::Live, changed);
+
+	if (changed == ApSettingsClass::fieldBit("Hostname"))
+	{
+		reconfiguration.finish(reconfiguration.Ap, WiFi.softAPsetHostname(settings.ApSettings.Hostname.c_str()));
+		return;
+	}
+
+	// Restore the default address if the custom address has been turned off.
+	if (!settings.ApSettings.Custom && previous.Custom)
+	{
+		WiFi.softAPConfig(IPAddress(192, 168, 4, 1), IPAddress(192, 168, 4, 1), IPAddress(255, 255, 255, 0));
+	}
+
+	createAP();
+	reconfiguration.finish(reconfiguration.Ap, apOK);
+
+	if (!apOK)
+	{
+		reconfiguration.reboot(reconfiguration.Ap);
+		diagnostics.restarting(RestartCause::Reconfigure);
+		setLed(LedPattern::Busy);
+		reboot = true;
+	}
+}
+
+/// <summary>
+/// Apply new WiFi settings in place: the station is disconnected and a network is selected again
+/// (with the new settings) while the access point stays up (see checkReconfigure).
+/// </summary>
+/// <param name="previous">The running WiFi settings</param>
+void applyWiFi(const WiFiSettingsClass& previous)
+{
+	uint32_t changed = settings.WiFiSettings.changed(previous);
+
+	if (changed == 0)
+	{
+		reconfiguration.start(reconfiguration.WiFi, ReconfigureResult::Unchanged, 0);
+		return;
+	}
+
+	settings.WiFiSettings.save();
+	reconfiguration.start(reconfiguration.WiFi, ReconfigureResult::Live, changed);
+
+	wifiOK = false;
+	WiFi.disconnect(false);
+
+	// Without a known network the station stays disconnected.
+	bool started = selector.start();
+	supervisor.begin(started);
+
+	if (!started)
+	{
+		reconfiguration.finish(reconfiguration.WiFi, settings.WiFiSettings.SSID == "");
+	}
+}
+
+/// <summary>
+/// Set the on board LED pattern.
+/// </summary>
+/// <param name="pattern">The LED pattern</param>
+void setLed(LedPattern pattern)
+{
+	switch (pattern)
+	{
+	case LedPattern::Running:
+		led = JLed(LED_BUILTIN).Blink(1000, 1000).Forever();
+		break;
+	case LedPattern::Busy:
+		led = JLed(LED_BUILTIN).Blink(250, 250).Forever();
+		break;
+	case LedPattern::Stopped:
+		led = JLed(LED_BUILTIN).Blink(1000, 2000).Forever();
+		break;
+	}
+}
+
+/// <summary>
+/// Check if we should start the WiFi SmartConfig and advance the running SmartConfig.
+/// The received credentials are saved and used without a reboot. If no credentials are
+/// received the configured WiFi network is reconnected (the settings are kept).
 /// </summary>
 void checkSmart(void)
 {
@@ -300,44 +450,71 @@ void checkSmart(void)
 	{
 		smartconfig = false;
 
-		if (WiFi.isConnected())
-		{
-			WiFi.disconnect();
-		}
-
-		//Init WiFi as Access Point and Station
-		if (wait4Mode())
+		if (smart.start())
 		{
-			//Start SmartConfig
-			WiFi.beginSmartConfig();
-
-			if (wait4Done())
-			{
-				Serial.println("SmartConfig received.");
-				wifiOK = wait4WiFi();
-			}
+			wifiOK = false;
+			setLed(LedPattern::Busy);
 		}
+	}
 
-		if (wifiOK)
+	if (smart.running() && smart.update())
+	{
+		if (smart.Status == SmartConfigClass::Connected)
 		{
+			wifiOK = true;
 			Serial.println("WiFi Connected.");
 			WiFiInfoClass info(WiFi);
 			info.print();
 
 			// Save the smart config WiFi settings.
-			settings.WiFiSettings.SSID = info.SSID;
-			settings.WiFiSettings.PASS = info.PASS;
+			settings.WiFiSettings.SSID = smart.SSID;
+			settings.WiFiSettings.PASS = smart.PASS;
 			settings.WiFiSettings.DHCP = true;
 			settings.WiFiSettings.save();
-
-			ESP.restart();
 		}
 		else
 		{
-			// Revert to default WiFi settings (default access point).
-			settings.clear();
-			ESP.restart();
+			Serial.print("SmartConfig failed: "); Serial.println(smart.Result);
+
+			// Reconnect to one of the known WiFi networks (in the background).
+			selector.start();
+		}
+
+		// Supervise the new (or restored) connection.
+		supervisor.begin(selector.Status != WiFiSelectorClass::Idle);
+
+		// Restore the access point (if switched off during SmartConfig).
+		if (apOK && ((WiFi.getMode() & WIFI_MODE_AP) == 0))
+		{
+			createAP();
 		}
+
+		setLed(LedPattern::Running);
+	}
+}
+
+/// <summary>
+/// Check if the WiFi station has been reconnected after a live reconfiguration.
+/// </summary>
+void checkReconfigure(void)
+{
+	if (!reconfiguration.WiFi.Pending)
+	{
+		return;
+	}
+
+	if (WiFi.status() == WL_CONNECTED)
+	{
+		wifiOK = true;
+		reconfiguration.finish(reconfiguration.WiFi, true);
+		Serial.print("WiFi reconfigured in "); Serial.print(reconfiguration.WiFi.Downtime); Serial.println(" msec");
+		WiFiInfoClass info(WiFi);
+		info.print();
+	}
+	else if (reconfiguration.expired(reconfiguration.WiFi) || (selector.Status == WiFiSelectorClass::Failed))
+	{
+		reconfiguration.finish(reconfiguration.WiFi, false);
+		Serial.println("WiFi reconfiguration not successful");
 	}
 }
 
@@ -354,6 +531,7 @@ void checkReboot(void)
 		if (--counter < 0)
 		{
 			reboot = false;
+			diagnostics.shutdown();
 			ESP.restart();
 		}
 		else
@@ -364,16 +542,479 @@ void checkReboot(void)
 }
 
 /// <summary>
-/// Check if watchdog timer has expired (goto deep sleep).
-/// Note that since no wake-up sources have been configured the chip will
-/// be in deep sleep mode indefinitely, until external reset is applied.
+/// Check if a pending firmware image has passed the health check (running for 30 seconds with the
+/// station connected or a page served, the access point alone does not prove the new image works).
+/// An image still pending after the deadline is rolled back (it may run but never connect).
+/// </summary>
+void checkHealth(void)
+{
+	if (ota.Pending && (wifiOK || (admission.Admitted > 0)) && (millis() > OtaUpdateClass::HEALTH_DELAY))
+	{
+		ota.confirm();
+	}
+	else if (ota.Pending && (millis() > OtaUpdateClass::HEALTH_DEADLINE))
+	{
+		diagnostics.restarting(RestartCause::Update);
+		diagnostics.shutdown();
+		ota.rollback();
+	}
+}
+
+/// <summary>
+/// Stream a chunk of an update image (body handler). The first chunk starts the update using
+/// the X-Update-MD5 or X-Update-SHA256 header (one is required), the last chunk verifies it.
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <param name="writer">The partition writer</param>
+/// <param name="data">The chunk data</param>
+/// <param name="len">The chunk length</param>
+/// <param name="index">The chunk offset</param>
+/// <param name="total">The image size</param>
+void handleUpdate(AsyncWebServerRequest* request, PartitionWriter& writer, uint8_t* data, size_t len, size_t index, size_t total)
+{
+	if (index == 0)
+	{
+		if (ota.Stream.Status == UpdateStreamClass::Running)
+		{
+			return;
+		}
+
+		AsyncWebHeader* md5 = request->getHeader("X-Update-MD5");
+		AsyncWebHeader* sha256 = request->getHeader("X-Update-SHA256");
+
+		bool started = ota.Stream.begin(&writer, total,
+			(md5 != NULL) ? md5->value().c_str() : NULL,
+			(sha256 != NULL) ? sha256->value().c_str() : NULL);
+		bool unmounted = started && (&writer == &ota.FileSystem);
+
+		if (unmounted)
+		{
+			filesystem.end();
+		}
+
+		updater = request;
+		request->onDisconnect([unmounted]() {
+			if (unmounted && (ota.Stream.Status == UpdateStreamClass::Running))
+			{
+				// The upload has been dropped, restart to mount the (unchanged) file system again.
+				diagnostics.restarting(RestartCause::Update);
+				commands.push(CommandType::Reboot);
+			}
+
+			ota.Stream.abort();
+			updater = NULL;
+		});
+	}
+
+	if (request != updater)
+	{
+		return;
+	}
+
+	ota.Stream.write(data, len);
+
+	if (index + len == total)
+	{
+		ota.Stream.end();
+	}
+}
+
+/// <summary>
+/// Send the update result (request handler, called after the complete body has been received).
+/// A successful update reboots the Knoblomat (a new firmware image is pending until confirmed).
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <param name="firmware">True for a firmware update</param>
+void finishUpdate(AsyncWebServerRequest* request, bool firmware)
+{
+	if (request != updater)
+	{
+		request->send(409, "text/html", "Update already running");
+		return;
+	}
+
+	bool ok = (ota.Stream.Status == UpdateStreamClass::Done);
+
+	if (ok && firmware)
+	{
+		ota.pending();
+	}
+
+	request->send(ok ? 200 : 400, "application/json", ota.serialize());
+
+	Serial.print("Update "); Serial.print(ok ? "successful: " : "failed: ");
+	Serial.print(ota.Stream.Written); Serial.print(" bytes, ");
+	Serial.print(ota.Stream.throughput()); Serial.println(" bytes/sec");
+
+	if (ok || (!firmware && (ota.Stream.Received > 0)))
+	{
+		// Restart with the new image (the file system has been unmounted for the update).
+		diagnostics.restarting(RestartCause::Update);
+		commands.push(CommandType::Reboot);
+	}
+}
+
+/// <summary>
+/// Execute the commands queued by the HTTP handlers (the settings, LED and flags are owned by the main task).
+/// </summary>
+void checkCommands(void)
+{
+	Command command;
+
+	while (commands.pop(command))
+	{
+		StaticJsonDocument<COMMAND_CAPACITY> body;
+		bool ok = (command.Body != NULL) && ContentFormatClass::parse(command.Body, command.Length, command.MsgPack, body);
+
+		switch (command.Type)
+		{
+		case CommandType::ApplyApSettings:
+		{
+			ApSettingsClass previous = settings.ApSettings;
+			if (ok) settings.ApSettings.deserialize(body.as<JsonObject>());
+			applyAp(previous);
+			break;
+		}
+		case CommandType::ApplyWiFiSettings:
+		{
+			WiFiSettingsClass previous = settings.WiFiSettings;
+			if (ok) settings.WiFiSettings.deserialize(body.as<JsonObject>());
+			applyWiFi(previous);
+			break;
+		}
+		case CommandType::ApplyGameSettings:
+			if (ok) settings.GameSettings.deserialize(body.as<JsonObject>());
+			settings.GameSettings.save();
+			break;
+		case CommandType::ApplyNetworks:
+			if (ok && networks.deserialize(body.as<JsonArray>()))
+			{
+				// The networks are used by the next selection (reconnect or reboot).
+				networks.save();
+			}
+
+			break;
+		case CommandType::Clear:
+			settings.clear();
+			networks.clear();
+			leaderboard.clear();
+			break;
+		case CommandType::Reboot:
+			diagnostics.restarting(RestartCause::Command);
+			setLed(LedPattern::Busy);
+			reboot = true;
+			break;
+		case CommandType::StartSmartConfig:
+			smartconfig = true;
+			break;
+		case CommandType::StartBenchmark:
+			benchmark = true;
+			break;
+		case CommandType::SetLedPattern:
+			setLed(command.Pattern);
+			break;
+		case CommandType::SubmitScore:
+		{
+			LeaderboardClass::Result result = leaderboard.submit(command.Entry);
+			Serial.print("Leaderboard: "); Serial.println(LeaderboardClass::name(result));
+
+			if (result == LeaderboardClass::Ranked)
+			{
+				leaderboard.save();
+			}
+
+			break;
+		}
+		}
+
+		commands.release(command);
+	}
+}
+
+/// <summary>
+/// Check if we should run the file system benchmark (reads all files).
+/// </summary>
+void checkBenchmark(void)
+{
+	if (benchmark)
+	{
+		benchmark = false;
+		filesystem.benchmark();
+		filesystem.print();
+	}
+}
+
+/// <summary>
+/// Exchange the game totals with the other Knoblomats (every 100 msec).
+/// </summary>
+void checkFleet(void)
+{
+	static unsigned long last = 0;
+
+	if ((wifiOK || apOK) && (millis() - last >= 100))
+	{
+		last = millis();
+		FleetScore score = {
+			(uint32_t)settings.GameSettings.Ties,
+			(uint32_t)settings.GameSettings.Wins,
+			(uint32_t)settings.GameSettings.Losses
+		};
+		fleet.update(score);
+	}
+}
+
+/// <summary>
+/// Supervise the WiFi station connection (every 100 msec): reconnect a lost connection with backoff
+/// (the access point stays up) and restart the Knoblomat if the failure budget is exhausted.
+/// </summary>
+void checkWiFi(void)
+{
+	static unsigned long last = 0;
+
+	if (smart.running() || selector.running() || reconfiguration.WiFi.Pending || (millis() - last < 100))
+	{
+		return;
+	}
+
+	last = millis();
+	bool connected = (WiFi.status() == WL_CONNECTED) && ((uint32_t)WiFi.localIP() != 0);
+
+	switch (supervisor.update(connected))
+	{
+	case WiFiSupervisorClass::Reconnect:
+		Serial.print("WiFi reconnect attempt: "); Serial.println(supervisor.Attempts);
+		selector.start();
+		break;
+	case WiFiSupervisorClass::Restart:
+		Serial.println("WiFi failure budget exhausted, restarting");
+		diagnostics.restarting(RestartCause::WiFi);
+		setLed(LedPattern::Busy);
+		reboot = true;
+		break;
+	default:
+		break;
+	}
+
+	wifiOK = (supervisor.Status == WiFiSupervisorClass::Connected);
+}
+
+/// <summary>
+/// Advance the WiFi network selection (scan, then try the known networks in turn).
+/// </summary>
+void checkNetworks(void)
+{
+	if (selector.running() && selector.update())
+	{
+		if (selector.Status == WiFiSelectorClass::Connected)
+		{
+			Serial.print("WiFi connected to "); Serial.print(selector.SSID);
+			Serial.print(" in "); Serial.print(selector.ConnectTime); Serial.println(" msec");
+		}
+		else
+		{
+			Serial.println("WiFi network selection not successful");
+		}
+	}
+}
+
+/// <summary>
+/// Save the boots captured at startup and keep the uptime in RTC memory up to date.
+/// </summary>
+void checkDiagnostics(void)
+{
+	diagnostics.update();
+}
+
+/// <summary>
+/// Shed the queued file requests waiting too long (also when no new requests arrive).
+/// </summary>
+void checkAdmission(void)
+{
+	admission.update();
+}
+
+/// <summary>
+/// Check if watchdog timer has expired (goto deep sleep).
+/// Note that since no wake-up sources have been configured the chip will
+/// be in deep sleep mode indefinitely, until external reset is applied.
+/// </summary>
+void checkTimer(void)
+{
+	if (timer.done()) {
+		Serial.println("Watchdog timer finished");
+		diagnostics.restarting(RestartCause::Sleep);
+		diagnostics.shutdown();
+		esp_deep_sleep_start();
+	}
+}
+
+/// <summary>
+/// Check if a section name is contained in a comma separated field list.
+/// </summary>
+/// <param name="fields">The field list (e.g. "settings,ap")</param>
+/// <param name="name">The section name</param>
+/// <returns>True if selected</returns>
+bool hasField(const String& fields, const char* name)
+{
+	int length = strlen(name);
+	int start = 0;
+
+	while (start <= (int)fields.length())
+	{
+		int end = fields.indexOf(',', start);
+		if (end < 0) end = fields.length();
+
+		if ((end - start == length) && (strncmp(fields.c_str() + start, name, length) == 0))
+		{
+			return true;
+		}
+
+		start = end + 1;
+	}
+
+	return false;
+}
+
+/// <summary>
+/// Write a named JSON section to the response stream (separated by a comma).
+/// </summary>
+/// <param name="stream">The response stream</param>
+/// <param name="first">True if this is the first section (updated)</param>
+/// <param name="name">The section name</param>
+/// <param name="json">The section JSON</param>
+void writeSection(Print& stream, bool& first, const char* name, const String& json)
+{
+	stream.print(first ? "\n\"" : ",\n\"");
+	stream.print(name);
+	stream.print("\": ");
+	stream.print(json);
+	first = false;
+}
+
+/// <summary>
+/// Write a named JSON section of a combined response (serialized straight into the stream).
+/// </summary>
+/// <param name="stream">The response stream</param>
+/// <param name="first">True if this is the first section (updated)</param>
+/// <param name="name">The section name</param>
+/// <param name="doc">The section document</param>
+void writeSection(Print& stream, bool& first, const char* name, const JsonDocument& doc)
+{
+	stream.print(first ? "\n\"" : ",\n\"");
+	stream.print(name);
+	stream.print("\": ");
+	serializeJsonPretty(doc, stream);
+	first = false;
+}
+
+/// <summary>
+/// Send a 503 (Service Unavailable) response if the command queue or the arena pool is full.
+/// </summary>
+/// <param name="request">The web server request</param>
+void sendBusy(AsyncWebServerRequest* request)
+{
+	AsyncWebServerResponse* response = request->beginResponse(503, "text/html", "Knoblomat busy");
+	response->addHeader("Retry-After", AdmissionControlClass::RETRY_AFTER);
+	request->send(response);
+}
+
+/// <summary>
+/// Read a game count of a leaderboard entry (a missing value is 0).
+/// </summary>
+/// <param name="value">The JSON value</param>
+/// <param name="count">The count (set if valid)</param>
+/// <returns>True if the value is missing or an integer in the range 0 to UINT16_MAX</returns>
+bool readCount(JsonVariant value, uint16_t& count)
+{
+	if (value.isNull())
+	{
+		count = 0;
+		return true;
+	}
+
+	if (!value.is<long>())
+	{
+		return false;
+	}
+
+	long number = value.as<long>();
+
+	if ((number < 0) || (number > UINT16_MAX))
+	{
+		return false;
+	}
+
+	count = (uint16_t)number;
+	return true;
+}
+
+/// <summary>
+/// Renders a placeholder of the config page (see data/config.html). Called on the web server task,
+/// the values are taken from the telemetry snapshot and the settings (no WiFi driver calls).
+/// The snapshot is taken once per page and kept in the arena block of the response.
 /// </summary>
-void checkTimer(void)
+/// <param name="id">The placeholder</param>
+/// <param name="buffer">The value buffer</param>
+/// <param name="size">The buffer size</param>
+/// <param name="context">The rendering context</param>
+/// <returns>The value length</returns>
+size_t renderPlaceholder(Placeholder id, char* buffer, size_t size, RenderContext& context)
 {
-	if (timer.done()) {
-		Serial.println("Watchdog timer finished");
-		esp_deep_sleep_start();
+	static_assert(sizeof(TelemetryData) + SettingsClass::CAPACITY + 16 <= TemplateRendererClass::CONTEXT_SIZE,
+		"The telemetry snapshot and the settings document do not fit the arena block of the page");
+	const char* text = NULL;
+
+	if (context.Data == NULL)
+	{
+		void* memory = context.Arena->allocate(sizeof(TelemetryData));
+
+		if (memory == NULL)
+		{
+			return 0;
+		}
+
+		context.Data = new (memory) TelemetryData();
+		telemetry.read(*static_cast<TelemetryData*>(context.Data));
 	}
+
+	const TelemetryData& data = *static_cast<const TelemetryData*>(context.Data);
+
+	switch (id)
+	{
+	case Placeholder::ServerApAddress: text = data.Ap.Address.c_str(); break;
+	case Placeholder::ServerWiFiAddress: text = data.WiFi.Address.c_str(); break;
+	case Placeholder::ServerName: text = ServerInfoClass::HOSTNAME; break;
+	case Placeholder::ServerPort: return snprintf(buffer, size, "%d", ServerInfoClass::PORT);
+	case Placeholder::ServerUrl: return snprintf(buffer, size, "http://%s", ServerInfoClass::HOSTNAME);
+	case Placeholder::ApSSID: text = data.Ap.SSID.c_str(); break;
+	case Placeholder::ApPASS: text = data.Ap.PASS.c_str(); break;
+	case Placeholder::ApNetworkID: text = data.Ap.NetworkID.c_str(); break;
+	case Placeholder::ApHostname: text = data.Ap.Hostname.c_str(); break;
+	case Placeholder::ApAddress: text = data.Ap.Address.c_str(); break;
+	case Placeholder::ApClients: return snprintf(buffer, size, "%d", data.Ap.Clients);
+	case Placeholder::ApMAC: text = data.Ap.MAC.c_str(); break;
+	case Placeholder::ApDisplay: text = apOK ? "block" : "none"; break;
+	case Placeholder::WiFiSSID: text = data.WiFi.SSID.c_str(); break;
+	case Placeholder::WiFiPASS: text = data.WiFi.PASS.c_str(); break;
+	case Placeholder::WiFiNetworkID: text = data.WiFi.NetworkID.c_str(); break;
+	case Placeholder::WiFiHostname: text = data.WiFi.Hostname.c_str(); break;
+	case Placeholder::WiFiAddress: text = data.WiFi.Address.c_str(); break;
+	case Placeholder::WiFiGateway: text = data.WiFi.Gateway.c_str(); break;
+	case Placeholder::WiFiSubnet: text = data.WiFi.Subnet.c_str(); break;
+	case Placeholder::WiFiDNS: text = data.WiFi.DNS.c_str(); break;
+	case Placeholder::WiFiBSSID: text = data.WiFi.BSSID.c_str(); break;
+	case Placeholder::WiFiMAC: text = data.WiFi.MAC.c_str(); break;
+	case Placeholder::WiFiDisplay: text = wifiOK ? "block" : "none"; break;
+	case Placeholder::SettingsJson:
+	{
+		ArenaJsonDocument<SettingsClass::CAPACITY> doc(context.Arena);
+		settings.serialize(doc.to<JsonObject>());
+		return serializeJson(doc, buffer, size);
+	}
+	default: break;
+	}
+
+	return (text != NULL) ? strlcpy(buffer, text, size) : 0;
 }
 
 /// <summary>
@@ -402,6 +1043,10 @@ void WiFiStationConnected(WiFiEvent_t event, WiFiEventInfo_t info)
 /// <param name="info">The WiFi event info</param>
 void WiFiStationDisconnected(WiFiEvent_t event, WiFiEventInfo_t info)
 {
+	if (event == SYSTEM_EVENT_STA_DISCONNECTED)
+	{
+		supervisor.disconnected();
+	}
 
 	Serial.println("Station disconnected");
 
@@ -423,7 +1068,7 @@ void WiFiStationLostIP(WiFiEvent_t event, WiFiEventInfo_t info)
 {
 	Serial.println("Station lost IP");
 	Serial.println("\n------------");
-	ESP.restart();
+	supervisor.lostIP();
 }
 
 /// <summary>
@@ -442,6 +1087,11 @@ void WiFiStopped(WiFiEvent_t event, WiFiEventInfo_t info)
 /// </summary>
 void setup()
 {
+	// Capture the reset reasons first (RTC memory only, saved by checkDiagnostics).
+	diagnostics.begin();
+	monitor.attach(diagnostics.probe());
+	TaskInfoClass::begin();
+
 	// Initialize non volatile storage and settings.
 	esp_err_t err = nvs_flash_init();
 
@@ -452,6 +1102,9 @@ void setup()
 		err = nvs_flash_init();
 	}
 
+	// Check for an unconfirmed firmware image (may roll back and restart).
+	ota.boot();
+
 	// Set the log level for all components to WARNING
 	esp_log_level_set("*", ESP_LOG_WARN);
 
@@ -464,7 +1117,11 @@ void setup()
 	Serial.println(COPYRIGHT);
 	Serial.println();
 
-	// Print system info.
+	// Print the reset reasons of this boot.
+	diagnostics.print();
+
+	// Compute the immutable system info once and print the system info.
+	SystemInfoClass::init();
 	SystemInfoClass info;
 	info.print();
 
@@ -472,22 +1129,24 @@ void setup()
 	settings.init();
 	Serial.println("Settings:");
 	Serial.println(settings.serialize());
+	Serial.println("Storage:");
+	Serial.println(settings.serializeStorage());
 
-	// Mount the SPIFFS.
-	if (!SPIFFS.begin())
+	// Initialize the leaderboard.
+	leaderboard.init();
+
+	// Initialize the additional WiFi networks and the network selection.
+	networks.init();
+	selector.begin(&settings.WiFiSettings, &networks, beginWiFi);
+
+	// Mount the file system.
+	if (!filesystem.begin())
 	{
-		Serial.println("An Error has occurred while mounting SPIFFS");
+		Serial.print("An Error has occurred while mounting "); Serial.println(FileSystemClass::NAME);
 		return;
 	}
 
-	Serial.println("SPIFFS content:");
-	File root = SPIFFS.open("/");
-	File file = root.openNextFile();
-
-	while (file) {
-		Serial.println("\t" + String(file.name()) + ", " + String(file.size()) + " bytes");
-		file = root.openNextFile();
-	}
+	filesystem.list();
 
 	// Set the WiFi event handler.
 	WiFi.onEvent(WiFiStationConnected, SYSTEM_EVENT_AP_STACONNECTED);
@@ -505,6 +1164,8 @@ void setup()
 		createAP();
 	}
 
+	supervisor.begin(selector.Status != WiFiSelectorClass::Idle);
+
 	if (wifiOK || apOK)
 	{
 		// Show Web server info.
@@ -518,49 +1179,75 @@ void setup()
 		if (MDNS.begin(ServerInfoClass::HOSTNAME)) {
 			Serial.println("mDNS responder started");
 
-			// Add web service to MDNS-SD
+			// Add web service to MDNS-SD (the TXT record marks fleet members)
 			MDNS.addService("http", "tcp", ServerInfoClass::PORT);
+			MDNS.addServiceTxt("http", "tcp", "fleet", String(FleetClass::PORT));
 		}
 		else
 		{
 			Serial.println("Error setting up MDNS responder!");
 		}
 
+		// Start sampling the WiFi and heap data.
+		telemetry.begin();
+
+		// Join the fleet and add the Knoblomats announced by mDNS.
+		if (fleet.begin(&fleetTransport, (uint32_t)ESP.getEfuseMac(), settings.ApSettings.SSID.c_str()))
+		{
+			int count = MDNS.queryService("http", "tcp");
+
+			for (int i = 0; i < count; ++i)
+			{
+				if (MDNS.hasTxt(i, "fleet"))
+				{
+					fleet.discover((uint32_t)MDNS.IP(i), MDNS.hostname(i).c_str());
+				}
+			}
+
+			Serial.print("Fleet started, mDNS services found: "); Serial.println(count);
+		}
+
 		// Setup handlers for bootstrap Web pages.
 
 		server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/index.html", "text/html");
+			admission.send(request, filesystem.fs(), "/index.html", "text/html");
 			timer.reset();
 			});
 
 		server.on("/home", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/index.html", "text/html");
+			admission.send(request, filesystem.fs(), "/index.html", "text/html");
 			timer.reset();
 			});
 
 		server.on("/help", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/help.html", "text/html");
+			admission.send(request, filesystem.fs(), "/help.html", "text/html");
 			timer.reset();
 			});
 
 		server.on("/config", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/config.html", "text/html");
+
+			// Render the page with the current values (falls back to the plain page if it has not been compiled).
+			if (!renderer.send(request, filesystem.fs(), "/config.html", renderPlaceholder))
+			{
+				admission.send(request, filesystem.fs(), "/config.html", "text/html");
+			}
+
 			timer.reset();
 			});
 
 		server.on("/about", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/about.html", "text/html");
+			admission.send(request, filesystem.fs(), "/about.html", "text/html");
 			timer.reset();
 			});
 
 		server.on("/error", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/error.html", "text/html");
+			admission.send(request, filesystem.fs(), "/error.html", "text/html");
 			timer.reset();
 			});
 
@@ -568,109 +1255,73 @@ void setup()
 
 		server.on("/favicon.ico", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/images/favicon.png", "image/png");
-			timer.reset();
-			});
-
-		server.on("/js/bootstrap.min.js", HTTP_GET, [](AsyncWebServerRequest* request) {
-			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/js/bootstrap.min.js", "text/javascript");
-			timer.reset();
-			});
-
-		server.on("/js/bootstrap.bundle.min.js", HTTP_GET, [](AsyncWebServerRequest* request) {
-			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/js/bootstrap.bundle.min.js", "text/javascript");
-			timer.reset();
-			});
-
-		server.on("/js/popper.min.js", HTTP_GET, [](AsyncWebServerRequest* request) {
-			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/js/popper.min.js", "text/javascript");
-			timer.reset();
-			});
-
-		server.on("/js/jquery-3.4.1.min.js", HTTP_GET, [](AsyncWebServerRequest* request) {
-			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/js/jquery-3.4.1.min.js", "text/javascript");
-			timer.reset();
-			});
-
-		server.on("/css/bootstrap.min.css", HTTP_GET, [](AsyncWebServerRequest* request) {
-			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/css/bootstrap.min.css", "text/css");
-			timer.reset();
-			});
-
-		server.on("/css/knoblomat.min.css", HTTP_GET, [](AsyncWebServerRequest* request) {
-			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/css/knoblomat.min.css", "text/css");
+			admission.send(request, filesystem.fs(), "/images/favicon.png", "image/png");
 			timer.reset();
 			});
 
-		server.on("/js/state-machine.min.js", HTTP_GET, [](AsyncWebServerRequest* request) {
+		server.on("/js/app.bundle.js", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/js/state-machine.min.js", "text/javascript");
+			admission.send(request, filesystem.fs(), "/js/app.bundle.js", "text/javascript", BUNDLE_CACHE_CONTROL);
 			timer.reset();
 			});
 
-		server.on("/js/jquery.inputmask.min.js", HTTP_GET, [](AsyncWebServerRequest* request) {
+		server.on("/css/app.bundle.css", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/js/jquery.inputmask.min.js", "text/javascript");
+			admission.send(request, filesystem.fs(), "/css/app.bundle.css", "text/css", BUNDLE_CACHE_CONTROL);
 			timer.reset();
 			});
 
 		server.on("/images/picture0.jpg", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/images/picture0.jpg", "image/jpg");
+			admission.send(request, filesystem.fs(), "/images/picture0.jpg", "image/jpg");
 			timer.reset();
 			});
 
 		server.on("/images/picture1.jpg", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/images/picture1.jpg", "image/jpg");
+			admission.send(request, filesystem.fs(), "/images/picture1.jpg", "image/jpg");
 			timer.reset();
 			});
 
 		server.on("/images/picture2.jpg", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/images/picture2.jpg", "image/jpg");
+			admission.send(request, filesystem.fs(), "/images/picture2.jpg", "image/jpg");
 			timer.reset();
 			});
 
 		server.on("/images/picture3.jpg", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/images/picture3.jpg", "image/jpg");
+			admission.send(request, filesystem.fs(), "/images/picture3.jpg", "image/jpg");
 			timer.reset();
 			});
 
 		server.on("/sounds/vista.mp3", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/sounds/vista.mp3", "audio/mpeg");
+			admission.send(request, filesystem.fs(), "/sounds/vista.mp3", "audio/mpeg");
 			timer.reset();
 			});
 
 		server.on("/sounds/click.mp3", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/sounds/click.mp3", "audio/mpeg");
+			admission.send(request, filesystem.fs(), "/sounds/click.mp3", "audio/mpeg");
 			timer.reset();
 			});
 
 		server.on("/sounds/win.mp3", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/sounds/win.mp3", "audio/mpeg");
+			admission.send(request, filesystem.fs(), "/sounds/win.mp3", "audio/mpeg");
 			timer.reset();
 			});
 
 		server.on("/sounds/tie.mp3", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/sounds/tie.mp3", "audio/mpeg");
+			admission.send(request, filesystem.fs(), "/sounds/tie.mp3", "audio/mpeg");
 			timer.reset();
 			});
 
 		server.on("/sounds/loss.mp3", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(SPIFFS, "/sounds/loss.mp3", "audio/mpeg");
+			admission.send(request, filesystem.fs(), "/sounds/loss.mp3", "audio/mpeg");
 			timer.reset();
 			});
 
@@ -694,9 +1345,14 @@ void setup()
 		server.on("/ap", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
 
+			if (!admission.accept(request)) return;
+
 			if (apOK) {
-				ApInfoClass info(WiFi);
-				request->send(200, "application/json", info.serialize());
+				RequestArena* arena = arenas.acquire(request);
+				if (arena == NULL) return sendBusy(request);
+				ArenaJsonDocument<TelemetryClass::AP_CAPACITY> doc(arena);
+				telemetry.serializeAp(doc.to<JsonObject>());
+				ContentFormatClass::send(request, 200, doc, arena);
 			}
 			else {
 				request->send(404, "text/html", "AP not available");
@@ -708,9 +1364,16 @@ void setup()
 		server.on("/wifi", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
 
+			if (!admission.accept(request)) return;
+
 			if (wifiOK) {
-				WiFiInfoClass info(WiFi);
-				request->send(200, "application/json", info.serialize());
+				RequestArena* arena = arenas.acquire(request);
+				if (arena == NULL) return sendBusy(request);
+				ArenaJsonDocument<TelemetryClass::WIFI_CAPACITY + WiFiSelectorClass::CAPACITY + JSON_OBJECT_SIZE(1)> doc(arena);
+				JsonObject root = doc.to<JsonObject>();
+				telemetry.serializeWiFi(root);
+				selector.serialize(root.createNestedObject("Selection"));
+				ContentFormatClass::send(request, 200, doc, arena);
 			}
 			else {
 				request->send(404, "text/html", "WiFi not available");
@@ -721,27 +1384,199 @@ void setup()
 
 		server.on("/game", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(200, "application/json", settings.GameSettings.serialize());
+
+			if (!admission.accept(request)) return;
+			RequestArena* arena = arenas.acquire(request);
+			if (arena == NULL) return sendBusy(request);
+			ArenaJsonDocument<GameSettingsClass::CAPACITY> doc(arena);
+			settings.GameSettings.serialize(doc.to<JsonObject>());
+			ContentFormatClass::send(request, 200, doc, arena);
 			timer.reset();
 			});
 
 		server.on("/server", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
+
+			if (!admission.accept(request)) return;
+			RequestArena* arena = arenas.acquire(request);
+			if (arena == NULL) return sendBusy(request);
 			ServerInfoClass info(WiFi);
-			request->send(200, "application/json", info.serialize());
+			ArenaJsonDocument<ServerInfoClass::CAPACITY> doc(arena);
+			info.serialize(doc.to<JsonObject>());
+			ContentFormatClass::send(request, 200, doc, arena);
 			timer.reset();
 			});
 
 		server.on("/system", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
+
+			if (!admission.accept(request)) return;
+			RequestArena* arena = arenas.acquire(request);
+			if (arena == NULL) return sendBusy(request);
 			SystemInfoClass info;
+			ArenaJsonDocument<SystemInfoClass::CAPACITY> doc(arena);
+			info.serialize(doc.to<JsonObject>());
+			ContentFormatClass::send(request, 200, doc, arena);
+			timer.reset();
+			});
+
+		server.on("/memory", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+
+			if (!admission.accept(request)) return;
+			MemoryInfoClass info;
+			request->send(200, "application/json", info.serialize());
+			timer.reset();
+			});
+
+		server.on("/tasks", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+
+			if (!admission.accept(request)) return;
+			RequestArena* arena = arenas.acquire(request);
+			if (arena == NULL) return sendBusy(request);
+
+			TaskInfoClass info;
+			ArenaJsonDocument<TaskInfoClass::CAPACITY> doc(arena);
+			info.serialize(doc.to<JsonObject>());
+
+			AsyncResponseStream* response = request->beginResponseStream("application/json");
+			bool first = true;
+
+			response->print("{");
+			writeSection(*response, first, "Tasks", doc);
+
+			writeSection(*response, first, "Loop", monitor.serialize());
+			response->print("\n}");
+			request->send(response);
+			timer.reset();
+			});
+
+		server.on("/telemetry", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+
+			if (!admission.accept(request)) return;
+
+			request->send(200, "application/json", telemetry.serialize());
+			timer.reset();
+			});
+
+		server.on("/admission", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+			request->send(200, "application/json", admission.serialize());
+			timer.reset();
+			});
+
+		server.on("/limiter", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+			request->send(200, "application/json", limiter.serialize());
+			timer.reset();
+			});
+
+		server.on("/storage", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+
+			if (!admission.accept(request)) return;
+			request->send(200, "application/json", settings.serializeStorage());
+			timer.reset();
+			});
+
+		server.on("/diagnostics", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+
+			if (!admission.accept(request)) return;
+			request->send(200, "application/json", diagnostics.serialize());
+			timer.reset();
+			});
+
+		server.on("/arena", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+			request->send(200, "application/json", arenas.serialize());
+			timer.reset();
+			});
+
+		server.on("/commands", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+			request->send(200, "application/json", commands.serialize());
+			timer.reset();
+			});
+
+		server.on("/fleet", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+
+			if (!admission.accept(request)) return;
+			FleetInfoClass info(fleet);
 			request->send(200, "application/json", info.serialize());
 			timer.reset();
 			});
 
+		server.on("/status", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+
+			if (!admission.accept(request)) return;
+
+			String fields = request->hasParam("fields") ? request->getParam("fields")->value() : String("settings,ap,wifi,server,system,game");
+			AsyncResponseStream* response = request->beginResponseStream("application/json");
+			bool first = true;
+
+			response->print("{");
+
+			if (hasField(fields, "settings")) {
+				writeSection(*response, first, "Settings", settings.serialize());
+			}
+
+			if (hasField(fields, "ap")) {
+				writeSection(*response, first, "Ap", apOK ? telemetry.serializeAp() : String("null"));
+			}
+
+			if (hasField(fields, "wifi")) {
+				writeSection(*response, first, "WiFi", wifiOK ? telemetry.serializeWiFi() : String("null"));
+			}
+
+			if (hasField(fields, "server")) {
+				ServerInfoClass info(WiFi);
+				writeSection(*response, first, "Server", info.serialize());
+			}
+
+			if (hasField(fields, "system")) {
+				SystemInfoClass info;
+				writeSection(*response, first, "System", info.serialize());
+			}
+
+			if (hasField(fields, "game")) {
+				writeSection(*response, first, "Game", settings.GameSettings.serialize());
+			}
+
+			if (hasField(fields, "admission")) {
+				writeSection(*response, first, "Admission", admission.serialize());
+			}
+
+			if (hasField(fields, "limiter")) {
+				writeSection(*response, first, "Limiter", limiter.serialize());
+			}
+
+			if (hasField(fields, "arena")) {
+				writeSection(*response, first, "Arena", arenas.serialize());
+			}
+
+			if (hasField(fields, "diagnostics")) {
+				writeSection(*response, first, "Diagnostics", diagnostics.serialize());
+			}
+
+			response->print("\n}");
+			request->send(response);
+			timer.reset();
+			});
+
 		server.on("/settings", HTTP_GET, [](AsyncWebServerRequest* request) {
 			Serial.print("GET Request() url: "); Serial.println(request->url());
-			request->send(200, "application/json", settings.serialize());
+
+			if (!admission.accept(request)) return;
+			RequestArena* arena = arenas.acquire(request);
+			if (arena == NULL) return sendBusy(request);
+			ArenaJsonDocument<SettingsClass::CAPACITY> doc(arena);
+			settings.serialize(doc.to<JsonObject>());
+			ContentFormatClass::send(request, 200, doc, arena);
 			timer.reset();
 			});
 
@@ -749,63 +1584,240 @@ void setup()
 
 		server.on("/smart", HTTP_POST, [](AsyncWebServerRequest* request) {
 			Serial.print("POST Request() url: "); Serial.println(request->url());
+			if (!limiter.allow(request, RateBudget::Expensive)) return;
+			if (!commands.push(CommandType::StartSmartConfig)) return sendBusy(request);
 			request->send(202, "text/html", "Knoblomat running ESP32 SmartConfig for 1 minute");
-			smartconfig = true;
+			timer.reset();
+			});
+
+		server.on("/networks", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+			request->send(200, "application/json", networks.serialize());
+			timer.reset();
+			});
+
+		server.on("/supervisor", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+			request->send(200, "application/json", supervisor.serialize());
+			timer.reset();
+			});
+
+		server.on("/reconfigure", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+			request->send(200, "application/json", reconfiguration.serialize());
+			timer.reset();
+			});
+
+		server.on("/smart", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+			request->send(200, "application/json", smart.serialize());
 			timer.reset();
 			});
 
 		server.on("/clear", HTTP_POST, [](AsyncWebServerRequest* request) {
 			Serial.print("POST Request() url: "); Serial.println(request->url());
+			if (!limiter.allow(request, RateBudget::Expensive)) return;
+			if (!commands.push(CommandType::Clear)) return sendBusy(request);
 			request->send(202, "text/html", "Knoblomat clearing non volatile storage");
-			settings.clear();
 			timer.reset();
 			});
 
 		server.on("/reset", HTTP_POST, [](AsyncWebServerRequest* request) {
 			Serial.print("POST Request() url: "); Serial.println(request->url());
+			if (!limiter.allow(request, RateBudget::Cheap)) return;
 			request->send(202, "text/html", "Knoblomat reset timer");
 			timer.reset();
 			});
 
 		server.on("/reboot", HTTP_POST, [](AsyncWebServerRequest* request) {
 			Serial.print("POST Request() url: "); Serial.println(request->url());
+			if (!limiter.allow(request, RateBudget::Expensive)) return;
+			if (!commands.push(CommandType::Reboot)) return sendBusy(request);
 			request->send(202, "text/html", "Knoblomat rebooting");
-			led = JLed(LED_BUILTIN).Blink(250, 250).Forever();
-			reboot = true;
+			});
+
+		server.on("/led", HTTP_POST, [](AsyncWebServerRequest* request) {
+			Serial.print("POST Request() url: "); Serial.println(request->url());
+			if (!limiter.allow(request, RateBudget::Cheap)) return;
+			String pattern = request->hasParam("pattern") ? request->getParam("pattern")->value() : String("running");
+
+			if (pattern == "running") {
+				if (!commands.push(LedPattern::Running)) return sendBusy(request);
+			}
+			else if (pattern == "busy") {
+				if (!commands.push(LedPattern::Busy)) return sendBusy(request);
+			}
+			else if (pattern == "stopped") {
+				if (!commands.push(LedPattern::Stopped)) return sendBusy(request);
+			}
+			else {
+				request->send(400, "text/html", "Invalid LED pattern");
+				return;
+			}
+
+			request->send(202, "text/html", "Knoblomat setting LED pattern");
+			timer.reset();
 			});
 
 		server.on("/ap", HTTP_POST, [](AsyncWebServerRequest* request) {}, NULL,
 			[](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
 				Serial.print("POST Request() url: "); Serial.println(request->url());
-				String json = String((char*)data).substring(0, len);
-				settings.ApSettings.deserialize(json);
-				settings.ApSettings.save();
-				request->send(202, "application/json", settings.serialize());
-				led = JLed(LED_BUILTIN).Blink(250, 250).Forever();
-				reboot = true;
+				if (!limiter.allow(request, RateBudget::Expensive)) return;
+
+				RequestArena* arena = arenas.acquire(request);
+				if (arena == NULL) return sendBusy(request);
+				ArenaJsonDocument<ApSettingsClass::CAPACITY> body(arena);
+
+				if (!ContentFormatClass::parse(request, data, len, body) || !body.is<JsonObject>()) {
+					request->send(400, "text/html", "Invalid ApSettings");
+					return;
+				}
+
+				if (!commands.push(CommandType::ApplyApSettings, data, len, ContentFormatClass::sendsMsgPack(request))) return sendBusy(request);
+
+				ContentFormatClass::send(request, 202, body, arena);
 			});
 
 		server.on("/wifi", HTTP_POST, [](AsyncWebServerRequest* request) {}, NULL,
 			[](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
 				Serial.print("POST Request() url: "); Serial.println(request->url());
-				String json = String((char*)data).substring(0, len);
-				settings.WiFiSettings.deserialize(json);
-				settings.WiFiSettings.save();
-				request->send(202, "application/json", settings.serialize());
-				led = JLed(LED_BUILTIN).Blink(250, 250).Forever();
-				reboot = true;
+				if (!limiter.allow(request, RateBudget::Expensive)) return;
+
+				RequestArena* arena = arenas.acquire(request);
+				if (arena == NULL) return sendBusy(request);
+				ArenaJsonDocument<WiFiSettingsClass::CAPACITY> body(arena);
+
+				if (!ContentFormatClass::parse(request, data, len, body) || !body.is<JsonObject>()) {
+					request->send(400, "text/html", "Invalid WiFiSettings");
+					return;
+				}
+
+				if (!commands.push(CommandType::ApplyWiFiSettings, data, len, ContentFormatClass::sendsMsgPack(request))) return sendBusy(request);
+
+				ContentFormatClass::send(request, 202, body, arena);
+			});
+
+		server.on("/networks", HTTP_POST, [](AsyncWebServerRequest* request) {}, NULL,
+			[](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+				Serial.print("POST Request() url: "); Serial.println(request->url());
+				if (!limiter.allow(request, RateBudget::Expensive)) return;
+
+				RequestArena* arena = arenas.acquire(request);
+				if (arena == NULL) return sendBusy(request);
+				ArenaJsonDocument<WiFiNetworksClass::CAPACITY> body(arena);
+
+				if (!ContentFormatClass::parse(request, data, len, body) || !body.is<JsonArray>()) {
+					request->send(400, "text/html", "Invalid WiFiNetworks");
+					return;
+				}
+
+				if (!commands.push(CommandType::ApplyNetworks, data, len, ContentFormatClass::sendsMsgPack(request))) return sendBusy(request);
+
+				request->send(202, "text/html", "Knoblomat saving WiFi networks");
 			});
 
 		server.on("/game", HTTP_POST, [](AsyncWebServerRequest* request) {}, NULL,
 			[](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
 				Serial.print("POST Request() url: "); Serial.println(request->url());
-				String json = String((char*)data).substring(0, len);
-				settings.GameSettings.deserialize(json);
-				settings.GameSettings.save();
-				request->send(202, "application/json", settings.serialize());
+				if (!limiter.allow(request, RateBudget::Expensive)) return;
+
+				RequestArena* arena = arenas.acquire(request);
+				if (arena == NULL) return sendBusy(request);
+				ArenaJsonDocument<GameSettingsClass::CAPACITY> body(arena);
+
+				if (!ContentFormatClass::parse(request, data, len, body) || !body.is<JsonObject>()) {
+					request->send(400, "text/html", "Invalid GameSettings");
+					return;
+				}
+
+				if (!commands.push(CommandType::ApplyGameSettings, data, len, ContentFormatClass::sendsMsgPack(request))) return sendBusy(request);
+
+				ContentFormatClass::send(request, 202, body, arena);
+				timer.reset();
+			});
+
+		server.on("/leaderboard", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+
+			if (!admission.accept(request)) return;
+			request->send(200, "application/json", leaderboard.serialize());
+			timer.reset();
+			});
+
+		server.on("/leaderboard", HTTP_POST, [](AsyncWebServerRequest* request) {}, NULL,
+			[](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+				Serial.print("POST Request() url: "); Serial.println(request->url());
+				if (!limiter.allow(request, RateBudget::Cheap)) return;
+
+				RequestArena* arena = arenas.acquire(request);
+				if (arena == NULL) return sendBusy(request);
+				ArenaJsonDocument<JSON_OBJECT_SIZE(4) + 48> body(arena);
+
+				if (!ContentFormatClass::parse(request, data, len, body) || !body.is<JsonObject>()) {
+					request->send(400, "text/html", "Invalid result");
+					return;
+				}
+
+				LeaderboardEntry entry = {};
+				strncpy(entry.Name, body["Name"] | "", sizeof(entry.Name) - 1);
+
+				if (entry.Name[0] == '\0') {
+					request->send(400, "text/html", "Invalid name");
+					return;
+				}
+
+				if (!readCount(body["Wins"], entry.Wins) || !readCount(body["Losses"], entry.Losses) ||
+					!readCount(body["Ties"], entry.Ties)) {
+					request->send(400, "text/html", "Invalid count");
+					return;
+				}
+
+				if (!commands.push(entry)) return sendBusy(request);
+
+				ContentFormatClass::send(request, 202, body, arena);
 				timer.reset();
 			});
 
+		server.on("/filesystem", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+			request->send(200, "application/json", filesystem.serialize());
+			timer.reset();
+			});
+
+		server.on("/filesystem", HTTP_POST, [](AsyncWebServerRequest* request) {
+			Serial.print("POST Request() url: "); Serial.println(request->url());
+			if (!limiter.allow(request, RateBudget::Expensive)) return;
+			if (!commands.push(CommandType::StartBenchmark)) return sendBusy(request);
+			request->send(202, "text/html", "Knoblomat running file system benchmark");
+			timer.reset();
+			});
+
+		// Setup handlers for streamed updates (raw image as request body).
+
+		server.on("/update", HTTP_GET, [](AsyncWebServerRequest* request) {
+			Serial.print("GET Request() url: "); Serial.println(request->url());
+			request->send(200, "application/json", ota.serialize());
+			timer.reset();
+			});
+
+		server.on("/update/firmware", HTTP_POST, [](AsyncWebServerRequest* request) {
+			Serial.print("POST Request() url: "); Serial.println(request->url());
+			finishUpdate(request, true);
+			timer.reset();
+			}, NULL,
+			[](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+				handleUpdate(request, ota.Firmware, data, len, index, total);
+			});
+
+		server.on("/update/fs", HTTP_POST, [](AsyncWebServerRequest* request) {
+			Serial.print("POST Request() url: "); Serial.println(request->url());
+			finishUpdate(request, false);
+			timer.reset();
+			}, NULL,
+			[](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+				handleUpdate(request, ota.FileSystem, data, len, index, total);
+			});
+
 		// Setup handler for not found - redirects to error page.
 
 		server.onNotFound([](AsyncWebServerRequest* request) {
@@ -824,7 +1836,7 @@ void setup()
 	else
 	{
 		Serial.print("No WiFi network - stopping");
-		led = JLed(LED_BUILTIN).Blink(1000, 2000).Forever();
+		setLed(LedPattern::Stopped);
 	}
 
 	// Start the watchdog timer
@@ -836,8 +1848,18 @@ void setup()
 /// </summary>
 void loop()
 {
-	led.Update();
-	checkSmart();
-	checkReboot();
-	checkTimer();
+	monitor.begin();
+	monitor.measure(LoopProbe::Led, []() { led.Update(); });
+	monitor.measure(LoopProbe::Commands, checkCommands);
+	monitor.measure(LoopProbe::Smart, checkSmart);
+	monitor.measure(LoopProbe::Reconfigure, checkReconfigure);
+	monitor.measure(LoopProbe::Networks, checkNetworks);
+	monitor.measure(LoopProbe::WiFi, checkWiFi);
+	monitor.measure(LoopProbe::Reboot, checkReboot);
+	monitor.measure(LoopProbe::Health, checkHealth);
+	monitor.measure(LoopProbe::Benchmark, checkBenchmark);
+	monitor.measure(LoopProbe::Fleet, checkFleet);
+	monitor.measure(LoopProbe::Timer, checkTimer);
+	monitor.measure(LoopProbe::Diagnostics, checkDiagnostics);
+	monitor.measure(LoopProbe::Admission, checkAdmission);
 }
@@ -0,0 +1,329 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="AdmissionControl.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+#include <ESP.h>
+
+#include "AdmissionControl.h"
+
+const char* AdmissionControlClass::RETRY_AFTER = "2";	// The Retry-After header value (seconds)
+
+/// <summary>
+///  Creates the mutex guarding the queue.
+/// </summary>
+AdmissionControlClass::AdmissionControlClass()
+{
+	mutex = xSemaphoreCreateRecursiveMutex();
+}
+
+/// <summary>
+///  Takes the queue mutex (recursive, the same task may take it again).
+/// </summary>
+void AdmissionControlClass::lock()
+{
+	xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+}
+
+/// <summary>
+///  Gives the queue mutex back.
+/// </summary>
+void AdmissionControlClass::unlock()
+{
+	xSemaphoreGiveRecursive(mutex);
+}
+
+/// <summary>
+///  Checks the heap threshold for a request not opening a file (e.g. JSON).
+///  If the request is rejected a 503 response has already been sent.
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <returns>True if the request should be handled</returns>
+bool AdmissionControlClass::accept(AsyncWebServerRequest* request)
+{
+	if (ESP.getFreeHeap() < MIN_FREE_HEAP)
+	{
+		shed(request);
+		return false;
+	}
+
+	lock();
+	++Admitted;
+	unlock();
+
+	return true;
+}
+
+/// <summary>
+///  Sends a file response if a slot is available, queues the request otherwise.
+///  If the queue is full or the heap threshold is crossed the request is shed (503).
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <param name="fs">The file system</param>
+/// <param name="path">The file path (static string)</param>
+/// <param name="contentType">The content type (static string)</param>
+/// <param name="cacheControl">The Cache-Control header value (static string, optional)</param>
+void AdmissionControlClass::send(AsyncWebServerRequest* request, fs::FS& fs, const char* path, const char* contentType, const char* cacheControl)
+{
+	lock();
+	dispatch();
+	expire();
+
+	if (ESP.getFreeHeap() < MIN_FREE_HEAP)
+	{
+		shed(request);
+	}
+	else if (Open < MAX_OPEN)
+	{
+		admit(request, fs, path, contentType, cacheControl);
+	}
+	else if (count < MAX_QUEUED)
+	{
+		PendingRequest& pending = queue[(head + count) % MAX_QUEUED];
+
+		pending.Request = request;
+		pending.FileSystem = &fs;
+		pending.Path = path;
+		pending.ContentType = contentType;
+		pending.CacheControl = cacheControl;
+		pending.Time = millis();
+
+		++count;
+		++Waiting;
+		++Queued;
+
+		request->onDisconnect([this, request]() { dequeue(request); });
+	}
+	else
+	{
+		shed(request);
+	}
+
+	unlock();
+}
+
+/// <summary>
+///  Takes a slot for a file response opened by the caller (e.g. a rendered page), returned by close().
+///  The request is not queued: if no slot is free or the heap threshold is crossed it is shed (503).
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <returns>True if a slot has been taken</returns>
+bool AdmissionControlClass::open(AsyncWebServerRequest* request)
+{
+	lock();
+	dispatch();
+	expire();
+
+	bool admitted = (ESP.getFreeHeap() >= MIN_FREE_HEAP) && (Open < MAX_OPEN);
+
+	if (admitted)
+	{
+		++Open;
+		++Admitted;
+	}
+	else
+	{
+		shed(request);
+	}
+
+	unlock();
+	return admitted;
+}
+
+/// <summary>
+///  Returns a slot taken by open() (the file has been closed) and admits waiting requests.
+/// </summary>
+void AdmissionControlClass::close()
+{
+	release();
+}
+
+/// <summary>
+///  Opens the file response and registers the release of the slot when the request is done.
+/// </summary>
+void AdmissionControlClass::admit(AsyncWebServerRequest* request, fs::FS& fs, const char* path, const char* contentType, const char* cacheControl)
+{
+	++Open;
+	++Admitted;
+
+	request->onDisconnect([this]() { release(); });
+
+	if (cacheControl != NULL)
+	{
+		AsyncWebServerResponse* response = request->beginResponse(fs, path, contentType);
+		response->addHeader("Cache-Control", cacheControl);
+		request->send(response);
+	}
+	else
+	{
+		request->send(fs, path, contentType);
+	}
+}
+
+/// <summary>
+///  Sends a 503 (Service Unavailable) response with a Retry-After header.
+/// </summary>
+void AdmissionControlClass::shed(AsyncWebServerRequest* request)
+{
+	lock();
+	++Shed;
+	unlock();
+
+	AsyncWebServerResponse* response = request->beginResponse(503, "text/html", "Knoblomat busy");
+	response->addHeader("Retry-After", RETRY_AFTER);
+	request->send(response);
+}
+
+/// <summary>
+///  Removes a queued request (the client disconnected while waiting).
+/// </summary>
+void AdmissionControlClass::dequeue(AsyncWebServerRequest* request)
+{
+	lock();
+
+	for (int i = 0; i < count; i++)
+	{
+		PendingRequest& pending = queue[(head + i) % MAX_QUEUED];
+
+		if (pending.Request == request)
+		{
+			pending.Request = NULL;
+			--Waiting;
+			break;
+		}
+	}
+
+	unlock();
+}
+
+/// <summary>
+///  Releases a slot (the file response has been completed) and admits waiting requests.
+/// </summary>
+void AdmissionControlClass::release()
+{
+	lock();
+	--Open;
+	dispatch();
+	unlock();
+}
+
+/// <summary>
+///  Sheds the queued requests waiting longer than MAX_WAIT (called periodically by the main task,
+///  so the wait is bounded without new requests). The mutex keeps a disconnecting request alive
+///  until it has been shed.
+/// </summary>
+void AdmissionControlClass::update()
+{
+	lock();
+	expire();
+	unlock();
+}
+
+/// <summary>
+///  Admits queued requests while slots are available, expired requests are shed.
+/// </summary>
+void AdmissionControlClass::dispatch()
+{
+	while (count > 0)
+	{
+		PendingRequest& pending = queue[head];
+
+		if (pending.Request != NULL)
+		{
+			if (millis() - pending.Time > MAX_WAIT)
+			{
+				++Expired;
+				pending.Request->onDisconnect(NULL);
+				shed(pending.Request);
+			}
+			else if (Open < MAX_OPEN)
+			{
+				admit(pending.Request, *pending.FileSystem, pending.Path, pending.ContentType, pending.CacheControl);
+			}
+			else
+			{
+				break;
+			}
+
+			--Waiting;
+		}
+
+		head = (head + 1) % MAX_QUEUED;
+		--count;
+	}
+}
+
+/// <summary>
+///  Sheds all expired requests and removes them (and the disconnected ones) from the queue.
+///  Unlike dispatch() this also drops the entries behind a waiting head, so a stalled queue
+///  does not reject fresh requests.
+/// </summary>
+void AdmissionControlClass::expire()
+{
+	unsigned long now = millis();
+	int kept = 0;
+
+	for (int i = 0; i < count; i++)
+	{
+		PendingRequest pending = queue[(head + i) % MAX_QUEUED];
+
+		if ((pending.Request != NULL) && (now - pending.Time > MAX_WAIT))
+		{
+			++Expired;
+			--Waiting;
+			pending.Request->onDisconnect(NULL);
+			shed(pending.Request);
+			pending.Request = NULL;
+		}
+
+		if (pending.Request != NULL)
+		{
+			queue[(head + kept) % MAX_QUEUED] = pending;
+			++kept;
+		}
+	}
+
+	count = kept;
+}
+
+/// <summary>
+///  Serialize the AdmissionControlClass instance to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String AdmissionControlClass::serialize()
+{
+	const int capacity = JSON_OBJECT_SIZE(6);
+	StaticJsonDocument<capacity> doc;
+	String json;
+
+	doc["Open"] = Open;
+	doc["Waiting"] = Waiting;
+	doc["Admitted"] = Admitted;
+	doc["Queued"] = Queued;
+	doc["Shed"] = Shed;
+	doc["Expired"] = Expired;
+
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Prints the AdmissionControlClass instance data on the Serial stream.
+/// </summary>
+void AdmissionControlClass::print()
+{
+	Serial.println("Admission Control:");
+	Serial.print("    Open:     "); Serial.println(Open);
+	Serial.print("    Waiting:  "); Serial.println(Waiting);
+	Serial.print("    Admitted: "); Serial.println(Admitted);
+	Serial.print("    Queued:   "); Serial.println(Queued);
+	Serial.print("    Shed:     "); Serial.println(Shed);
+	Serial.print("    Expired:  "); Serial.println(Expired);
+}
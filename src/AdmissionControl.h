@@ -0,0 +1,80 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="AdmissionControl.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <FS.h>
+#include <ESPAsyncWebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+/// <summary>
+/// This class limits the number of concurrently open file responses.
+/// Excess requests are queued (bounded wait) and started when a running response completes.
+/// If the free heap drops below a threshold requests are shed with a 503 (Service Unavailable).
+/// The requests are admitted by the async_tcp task (handlers and disconnect callbacks), the main task
+/// sheds the requests waiting too long (see update). The queue is guarded by a recursive mutex
+/// (a disconnect callback may run while a response is sent).
+/// </summary>
+class AdmissionControlClass
+{
+public:
+	static const int MAX_OPEN = 4;				// The maximum number of open file responses
+	static const int MAX_QUEUED = 8;			// The maximum number of queued requests
+	static const int MAX_WAIT = 2000;			// The maximum queue wait time (msec)
+	static const int MIN_FREE_HEAP = 24000;		// The heap threshold for shedding requests (bytes)
+	static const char* RETRY_AFTER;				// The Retry-After header value (seconds)
+
+private:
+	/// <summary>
+	/// A queued file request waiting for admission.
+	/// </summary>
+	struct PendingRequest
+	{
+		AsyncWebServerRequest* Request;			// The waiting request (NULL if removed)
+		fs::FS* FileSystem;						// The file system
+		const char* Path;						// The file path
+		const char* ContentType;				// The content type
+		const char* CacheControl;				// The Cache-Control header (optional)
+		unsigned long Time;						// The time queued (msec)
+	};
+
+	PendingRequest queue[MAX_QUEUED];				// The FIFO queue (ring buffer)
+	int head = 0;								// The index of the oldest entry
+	int count = 0;								// The number of entries (including removed)
+	SemaphoreHandle_t mutex;					// Guards the queue and the counters
+
+	void lock();
+	void unlock();
+
+	void admit(AsyncWebServerRequest* request, fs::FS& fs, const char* path, const char* contentType, const char* cacheControl);
+	void dequeue(AsyncWebServerRequest* request);
+	void release();
+	void dispatch();
+	void expire();
+
+public:
+	int Open = 0;								// The number of open file responses
+	int Waiting = 0;							// The number of queued requests
+	uint32_t Admitted = 0;						// The total number of admitted requests
+	uint32_t Queued = 0;						// The total number of queued requests
+	uint32_t Shed = 0;							// The total number of shed requests (503)
+	uint32_t Expired = 0;						// The total number of queued requests timed out
+
+	AdmissionControlClass();
+
+	bool accept(AsyncWebServerRequest* request);	// Checks the heap threshold (JSON requests)
+	void send(AsyncWebServerRequest* request, fs::FS& fs, const char* path, const char* contentType, const char* cacheControl = NULL);
+	bool open(AsyncWebServerRequest* request);	// Takes a slot for a file opened by the caller (not queued)
+	void close();								// Returns a slot taken by open()
+	void shed(AsyncWebServerRequest* request);	// Sends a 503 (Service Unavailable) response
+	void update();								// Sheds the requests waiting too long (main task)
+
+	String serialize();							// Return a string serialization (JSON)
+	void print();								// Prints all fields on the serial line
+};
@@ -22,13 +22,15 @@ ApInfoClass::ApInfoClass(WiFiClass wifi)
 	wifi_config_t config;
 	esp_wifi_get_config(WIFI_IF_AP, &config);
 
-	SSID = String(reinterpret_cast<const char*>(config.ap.ssid));
-	PASS = String(reinterpret_cast<const char*>(config.ap.password));
-	Hostname = String(WiFi.softAPgetHostname());
-	NetworkID = wifi.softAPNetworkID().toString();
-	Address = wifi.softAPIP().toString();
+	uint8_t mac[6];
+
+	SSID.assign(reinterpret_cast<const char*>(config.ap.ssid));
+	PASS.assign(reinterpret_cast<const char*>(config.ap.password));
+	Hostname.assign(WiFi.softAPgetHostname());
+	formatAddress(NetworkID, wifi.softAPNetworkID());
+	formatAddress(Address, wifi.softAPIP());
 	Clients = wifi.softAPgetStationNum();
-	MAC = wifi.softAPmacAddress();
+	formatMAC(MAC, wifi.softAPmacAddress(mac));
 }
 
 /// <summary>
@@ -41,13 +43,13 @@ String ApInfoClass::serialize()
 	StaticJsonDocument<capacity> settings;
 	String json;
 
-	settings["SSID"] = SSID;
-	settings["PASS"] = PASS;
-	settings["Hostname"] = Hostname;
-	settings["NetworkID"] = NetworkID;
-	settings["Address"] = Address;
+	settings["SSID"] = SSID.c_str();
+	settings["PASS"] = PASS.c_str();
+	settings["Hostname"] = Hostname.c_str();
+	settings["NetworkID"] = NetworkID.c_str();
+	settings["Address"] = Address.c_str();
 	settings["Clients"] = Clients;
-	settings["MAC"] = MAC;
+	settings["MAC"] = MAC.c_str();
 
 	serializeJsonPretty(settings, json);
 
@@ -60,11 +62,11 @@ String ApInfoClass::serialize()
 void ApInfoClass::print()
 {
 	Serial.println("WiFi Accesspoint Info:");
-	Serial.print("    SSID:      "); Serial.println(SSID);
-	Serial.print("    PASS:      "); Serial.println(PASS);
-	Serial.print("    Hostname:  "); Serial.println(Hostname);
-	Serial.print("    NetworkID: "); Serial.println(NetworkID);
-	Serial.print("    Address:   "); Serial.println(Address);
+	Serial.print("    SSID:      "); Serial.println(SSID.c_str());
+	Serial.print("    PASS:      "); Serial.println(PASS.c_str());
+	Serial.print("    Hostname:  "); Serial.println(Hostname.c_str());
+	Serial.print("    NetworkID: "); Serial.println(NetworkID.c_str());
+	Serial.print("    Address:   "); Serial.println(Address.c_str());
 	Serial.print("    Clients:   "); Serial.println(Clients);
-	Serial.print("    MAC:       "); Serial.println(MAC);
+	Serial.print("    MAC:       "); Serial.println(MAC.c_str());
 }
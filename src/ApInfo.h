@@ -10,6 +10,8 @@
 
 #include <WiFi.h>
 
+#include "FixedString.h"
+
 /// <summary>
 /// This class holds the actual WiFi access point data.
 /// </summary>
@@ -18,13 +20,13 @@ class ApInfoClass
 public:
 	ApInfoClass(WiFiClass wifi);			// Using a WiFi instance to get the data
 
-	String SSID;							// The WiFi Access Point SSID
-	String PASS;							// The WiFi Access Point passphrase
-	String Hostname;						// The WiFi Access Point hostname
-	String NetworkID;						// The WiFi Access Point network ID
-	String Address;							// The WiFi Access Point IP address
+	FixedString<32> SSID;					// The WiFi Access Point SSID
+	FixedString<64> PASS;					// The WiFi Access Point passphrase
+	FixedString<32> Hostname;				// The WiFi Access Point hostname
+	FixedString<15> NetworkID;				// The WiFi Access Point network ID
+	FixedString<15> Address;				// The WiFi Access Point IP address
 	int Clients;							// The number of clients (max. 4)
-	String MAC;								// The WiFi Access Point MAC address
+	FixedString<17> MAC;					// The WiFi Access Point MAC address
 
 	String serialize();						// Return a string serialization (JSON)
 	void print();							// Prints all fields on the serial line
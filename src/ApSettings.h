@@ -8,50 +8,45 @@
 // --------------------------------------------------------------------------------------------------------------------
 #pragma once
 
-#include <Preferences.h>
+#include "SettingsBase.h"
 
 /// <summary>
 /// This class holds the WiFi access point configuration data.
 /// </summary>
-class ApSettingsClass
+class ApSettingsClass : public SettingsBaseClass<ApSettingsClass>
 {
-private:
-	const char* NAMESPACE = "AP";				// The namspace used in preferences
-	const char* KEY_SSID = "SSID";				// The preference key for the SSID field
-	const char* KEY_PASS = "PASS";				// The preference key for the passphrase field
-	const char* KEY_CUSTOM = "Custom";			// The preference key for the Custom field
-	const char* KEY_HOSTNAME = "Hostname";		// The preference key for the Hostname field
-	const char* KEY_ADDRESS = "Address";		// The preference key for the Address field
-	const char* KEY_GATEWAY = "Gateway";		// The preference key for the Gateway field
-	const char* KEY_SUBNET = "Subnet";			// The preference key for the SubnetMask field
-
-	const char* SUBNET_MASK = "255.255.255.0";	// The default network mask
-
-	const int MAX_SSID_LEN = 32;				// The maximum length for the SSID
-	const int MAX_PASS_LEN = 64;				// The maximum length for the PASS
-	const int MAX_HOSTNAME_LEN = 32;			// The maximum length for the hostname
-	const int MAX_IPADDRESS_LEN = 15;			// The maximum length for an IP address
-
-	Preferences preferences;					// The EPS32 preferences instance
-
 public:
-	static char* WIFI_SSID_AP;					// The default access point SSID
-	static char* WIFI_HOSTNAME;					// The default access point hostname
+	static constexpr const char* NAMESPACE = "AP";				// The namspace used in preferences
+	static const uint8_t VERSION = 1;				// The blob schema version
+	static constexpr const char* WIFI_SSID_AP = "KNOBLOMAT_";	// The default access point SSID
+	static constexpr const char* WIFI_HOSTNAME = "knoblomat";	// The default access point hostname
+	static constexpr const char* SUBNET_MASK = "255.255.255.0";	// The default network mask
+
+	static const int MAX_SSID_LEN = 32;				// The maximum length for the SSID
+	static const int MAX_PASS_LEN = 64;				// The maximum length for the PASS
+	static const int MAX_HOSTNAME_LEN = 32;			// The maximum length for the hostname
+	static const int MAX_IPADDRESS_LEN = 15;		// The maximum length for an IP address
 
 	ApSettingsClass();
 
-	String SSID;								// The WiFi Access Point SSID
-	String PASS;								// The WiFi Access Point Passphrase
+	FixedString<MAX_SSID_LEN> SSID;				// The WiFi Access Point SSID
+	FixedString<MAX_PASS_LEN> PASS;				// The WiFi Access Point Passphrase
 	bool Custom;								// The WiFi Custom mode (default: false)
-	String Hostname;							// The WiFi Access Point Hostname
-	String Address;								// The WiFi Access Point Address
-	String Gateway;								// The Gateway address
-	String Subnet;								// The SubnetMask
-
-	bool deserialize(String settings);			// Read a JSON string and updates the fields.
-	String serialize();							// Return a string serialization (JSON)
-	void clear();								// Clears the persistent storage
-	void save();								// Save the fields to storage
-	void init();								// Initializes the fields from storage
+	FixedString<MAX_HOSTNAME_LEN> Hostname;		// The WiFi Access Point Hostname
+	FixedString<MAX_IPADDRESS_LEN> Address;		// The WiFi Access Point Address
+	FixedString<MAX_IPADDRESS_LEN> Gateway;		// The Gateway address
+	FixedString<MAX_IPADDRESS_LEN> Subnet;		// The SubnetMask
+
+	// The field descriptors (JSON and preference keys, limits and defaults).
+	static constexpr FieldDescriptor<ApSettingsClass> FIELDS[] = {
+		textField<ApSettingsClass, MAX_SSID_LEN, &ApSettingsClass::SSID>("SSID", WIFI_SSID_AP),
+		textField<ApSettingsClass, MAX_PASS_LEN, &ApSettingsClass::PASS>("PASS", ""),
+		textField<ApSettingsClass, MAX_HOSTNAME_LEN, &ApSettingsClass::Hostname>("Hostname", WIFI_HOSTNAME),
+		flagField("Custom", &ApSettingsClass::Custom, false),
+		textField<ApSettingsClass, MAX_IPADDRESS_LEN, &ApSettingsClass::Address>("Address", ""),
+		textField<ApSettingsClass, MAX_IPADDRESS_LEN, &ApSettingsClass::Gateway>("Gateway", ""),
+		textField<ApSettingsClass, MAX_IPADDRESS_LEN, &ApSettingsClass::Subnet>("Subnet", SUBNET_MASK),
+	};
+
+	static constexpr int CAPACITY = fieldCapacity(FIELDS);	// The JSON document capacity
 };
-
@@ -0,0 +1,212 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="ArenaPool.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+
+#include "ArenaPool.h"
+
+/// <summary>
+///  Allocates memory from the block (8 byte aligned). The memory is valid until the block is released.
+/// </summary>
+/// <param name="size">The number of bytes</param>
+/// <returns>The memory (NULL if the block is full)</returns>
+void* RequestArena::allocate(size_t size)
+{
+	size_t start = (used + 7) & ~(size_t)7;
+
+	if ((start > ArenaPoolClass::BLOCK_SIZE) || (size > ArenaPoolClass::BLOCK_SIZE - start))
+	{
+		pool->record(used, true);
+		return NULL;
+	}
+
+	used = start + size;
+	pool->record(used, false);
+
+	return data + start;
+}
+
+/// <summary>
+///  Returns the number of free bytes (ignoring the alignment of the next allocation).
+/// </summary>
+/// <returns>The number of bytes</returns>
+size_t RequestArena::available() const
+{
+	return ArenaPoolClass::BLOCK_SIZE - used;
+}
+
+/// <summary>
+///  Initializes the block allocators (all blocks are free).
+/// </summary>
+ArenaPoolClass::ArenaPoolClass() : mask(0)
+{
+	for (int i = 0; i < BLOCKS; ++i)
+	{
+		arenas[i].pool = this;
+		arenas[i].data = storage[i];
+	}
+}
+
+/// <summary>
+///  Takes a free block (async_tcp task only). The used mask is updated with a compare and swap,
+///  so blocks released concurrently by the main task are seen.
+/// </summary>
+/// <returns>The arena (NULL if all blocks are in use)</returns>
+RequestArena* ArenaPoolClass::acquire()
+{
+	uint32_t current = mask.load(std::memory_order_acquire);
+
+	for (;;)
+	{
+		int index = 0;
+
+		while ((index < BLOCKS) && (current & (1u << index)))
+		{
+			++index;
+		}
+
+		if (index == BLOCKS)
+		{
+			++Exhausted;
+			return NULL;
+		}
+
+		if (mask.compare_exchange_weak(current, current | (1u << index), std::memory_order_acq_rel))
+		{
+			RequestArena* arena = &arenas[index];
+			arena->used = 0;
+			arena->owner = NULL;
+
+			++Acquired;
+			HighWater = max(HighWater, (uint32_t)__builtin_popcount(current | (1u << index)));
+
+			return arena;
+		}
+	}
+}
+
+/// <summary>
+///  Takes a free block for a request. The block is returned when the request is done (disconnect),
+///  so the response may be sent from the block memory. A request holds a single block, further calls
+///  (e.g. for the next body chunk) return the same block.
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <returns>The arena (NULL if all blocks are in use)</returns>
+RequestArena* ArenaPoolClass::acquire(AsyncWebServerRequest* request)
+{
+	for (int i = 0; i < BLOCKS; ++i)
+	{
+		if (arenas[i].owner == request)
+		{
+			return &arenas[i];
+		}
+	}
+
+	RequestArena* arena = acquire();
+
+	if (arena != NULL)
+	{
+		arena->owner = request;
+		request->onDisconnect([this, arena]() {
+			arena->owner = NULL;
+			release(arena);
+			});
+	}
+
+	return arena;
+}
+
+/// <summary>
+///  Returns a block to the pool (any task). All allocations of the block are released.
+/// </summary>
+/// <param name="arena">The arena (NULL is ignored)</param>
+void ArenaPoolClass::release(RequestArena* arena)
+{
+	if (arena != NULL)
+	{
+		mask.fetch_and(~(1u << (arena - arenas)), std::memory_order_release);
+	}
+}
+
+/// <summary>
+///  Returns the block holding the memory to the pool (any task).
+/// </summary>
+/// <param name="pointer">The memory allocated from the block (NULL is ignored)</param>
+void ArenaPoolClass::release(const void* pointer)
+{
+	const uint8_t* address = (const uint8_t*)pointer;
+
+	if ((address >= &storage[0][0]) && (address < &storage[0][0] + sizeof(storage)))
+	{
+		release(&arenas[(address - &storage[0][0]) / BLOCK_SIZE]);
+	}
+}
+
+/// <summary>
+///  Returns the number of blocks in use (snapshot).
+/// </summary>
+/// <returns>The number of blocks</returns>
+int ArenaPoolClass::count()
+{
+	return __builtin_popcount(mask.load(std::memory_order_acquire));
+}
+
+/// <summary>
+///  Updates the allocation statistics (async_tcp task only).
+/// </summary>
+/// <param name="used">The number of bytes used in the block</param>
+/// <param name="overflow">True if the allocation did not fit</param>
+void ArenaPoolClass::record(size_t used, bool overflow)
+{
+	PeakBytes = max(PeakBytes, (uint32_t)used);
+
+	if (overflow)
+	{
+		++Overflows;
+	}
+}
+
+/// <summary>
+///  Serialize the pool statistics to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String ArenaPoolClass::serialize()
+{
+	StaticJsonDocument<JSON_OBJECT_SIZE(8)> doc;
+	String json;
+
+	doc["Blocks"] = (int)BLOCKS;
+	doc["BlockSize"] = (uint32_t)BLOCK_SIZE;
+	doc["InUse"] = count();
+	doc["HighWater"] = HighWater;
+	doc["PeakBytes"] = PeakBytes;
+	doc["Acquired"] = Acquired;
+	doc["Exhausted"] = Exhausted;
+	doc["Overflows"] = Overflows;
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Prints the ArenaPoolClass instance data on the Serial stream.
+/// </summary>
+void ArenaPoolClass::print()
+{
+	Serial.println("Arena Pool:");
+	Serial.print("    Blocks:    "); Serial.println(BLOCKS);
+	Serial.print("    BlockSize: "); Serial.println(BLOCK_SIZE);
+	Serial.print("    InUse:     "); Serial.println(count());
+	Serial.print("    HighWater: "); Serial.println(HighWater);
+	Serial.print("    PeakBytes: "); Serial.println(PeakBytes);
+	Serial.print("    Acquired:  "); Serial.println(Acquired);
+	Serial.print("    Exhausted: "); Serial.println(Exhausted);
+	Serial.print("    Overflows: "); Serial.println(Overflows);
+}
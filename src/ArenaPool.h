@@ -0,0 +1,87 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="ArenaPool.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+class ArenaPoolClass;
+
+/// <summary>
+/// A fixed block of the arena pool used by a single request (bump allocation, no individual free).
+/// All allocations are released at once when the block is returned to the pool.
+/// </summary>
+class RequestArena
+{
+	friend class ArenaPoolClass;
+
+private:
+	ArenaPoolClass* pool = NULL;				// The owning pool
+	uint8_t* data = NULL;						// The block memory
+	AsyncWebServerRequest* owner = NULL;		// The request holding the block (NULL if none)
+	size_t used = 0;							// The number of allocated bytes
+
+public:
+	void* allocate(size_t size);				// Allocates memory (8 byte aligned, NULL if full)
+	size_t available() const;					// Returns the number of free bytes
+};
+
+/// <summary>
+/// This class holds a preallocated pool of fixed blocks used for the JSON documents and response buffers
+/// of the HTTP handlers (no heap allocation). A block is taken for a request and returned when the
+/// request is done (disconnect), or by the main task for a queued command body.
+/// Blocks are taken on the async_tcp task only, the used mask can be released from any task.
+/// </summary>
+class ArenaPoolClass
+{
+public:
+	static const int BLOCKS = 6;				// The number of blocks
+	static const size_t BLOCK_SIZE = 3072;		// The block size (bytes)
+
+private:
+	alignas(8) uint8_t storage[BLOCKS][BLOCK_SIZE];	// The block memory
+	RequestArena arenas[BLOCKS];				// The block allocators
+	std::atomic<uint32_t> mask;					// The blocks in use (one bit per block)
+
+	friend class RequestArena;
+	void record(size_t used, bool overflow);	// Updates the allocation statistics
+
+public:
+	uint32_t HighWater = 0;						// The maximum number of blocks in use
+	uint32_t PeakBytes = 0;						// The maximum number of bytes used in a block
+	uint32_t Acquired = 0;						// The total number of blocks taken
+	uint32_t Exhausted = 0;						// The total number of requests without a free block
+	uint32_t Overflows = 0;						// The total number of allocations not fitting a block
+
+	ArenaPoolClass();
+
+	RequestArena* acquire();					// Takes a free block (NULL if none)
+	RequestArena* acquire(AsyncWebServerRequest* request);	// Takes the block of a request (released on disconnect)
+	void release(RequestArena* arena);			// Returns a block to the pool
+	void release(const void* pointer);			// Returns the block holding the memory
+	int count();								// Returns the number of blocks in use
+
+	String serialize();							// Return a string serialization (JSON)
+	void print();								// Prints all fields on the serial line
+};
+
+/// <summary>
+/// A JSON document using the memory of a request arena instead of the stack or the heap.
+/// If the arena is full the document has no capacity (all writes fail).
+/// </summary>
+template <size_t CAPACITY>
+class ArenaJsonDocument : public JsonDocument
+{
+	static_assert(CAPACITY <= ArenaPoolClass::BLOCK_SIZE, "The document does not fit an arena block");
+
+public:
+	explicit ArenaJsonDocument(RequestArena* arena) : JsonDocument((char*)arena->allocate(CAPACITY), CAPACITY) {}
+};
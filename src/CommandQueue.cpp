@@ -0,0 +1,162 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="CommandQueue.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+
+#include "CommandQueue.h"
+
+/// <summary>
+///  Pushes a command (producer only). The slot is written before the tail index is published.
+///  If the queue is full the command is dropped and the body (if any) is released.
+/// </summary>
+/// <param name="command">The command</param>
+/// <returns>True if queued</returns>
+bool CommandQueueClass::push(const Command& command)
+{
+	uint8_t t = tail.load(std::memory_order_relaxed);
+	uint8_t next = (t + 1) % SIZE;
+
+	if (next == head.load(std::memory_order_acquire))
+	{
+		pool.release(command.Body);
+		++Dropped;
+		return false;
+	}
+
+	slots[t] = command;
+	tail.store(next, std::memory_order_release);
+	++Pushed;
+
+	return true;
+}
+
+/// <summary>
+///  Pushes a command without body (producer only).
+/// </summary>
+/// <param name="type">The command type</param>
+/// <returns>True if queued</returns>
+bool CommandQueueClass::push(CommandType type)
+{
+	Command command = { type, LedPattern::Running, false, 0, NULL, {} };
+	return push(command);
+}
+
+/// <summary>
+///  Pushes a command with a copy of the (validated) request body (producer only).
+///  The body is copied into a block of the arena pool (dropped if larger than a block or no block is free).
+/// </summary>
+/// <param name="type">The command type</param>
+/// <param name="data">The body data</param>
+/// <param name="len">The body length</param>
+/// <param name="msgpack">True if the body is MessagePack encoded</param>
+/// <returns>True if queued</returns>
+bool CommandQueueClass::push(CommandType type, const uint8_t* data, size_t len, bool msgpack)
+{
+	uint32_t start = micros();
+	RequestArena* arena = (len <= ArenaPoolClass::BLOCK_SIZE) ? pool.acquire() : NULL;
+	uint8_t* body = (arena != NULL) ? (uint8_t*)arena->allocate(len) : NULL;
+
+	if (body == NULL)
+	{
+		pool.release(arena);
+		++Dropped;
+		return false;
+	}
+
+	memcpy(body, data, len);
+
+	Command command = { type, LedPattern::Running, msgpack, (uint16_t)len, body, {} };
+	bool ok = push(command);
+
+	MaxLatency = max(MaxLatency, (uint32_t)(micros() - start));
+	return ok;
+}
+
+/// <summary>
+///  Pushes a SetLedPattern command (producer only).
+/// </summary>
+/// <param name="pattern">The LED pattern</param>
+/// <returns>True if queued</returns>
+bool CommandQueueClass::push(LedPattern pattern)
+{
+	Command command = { CommandType::SetLedPattern, pattern, false, 0, NULL, {} };
+	return push(command);
+}
+
+/// <summary>
+///  Pushes a SubmitScore command (producer only). The result is copied into the slot (no allocation).
+/// </summary>
+/// <param name="entry">The player result</param>
+/// <returns>True if queued</returns>
+bool CommandQueueClass::push(const LeaderboardEntry& entry)
+{
+	Command command = { CommandType::SubmitScore, LedPattern::Running, false, 0, NULL, entry };
+	return push(command);
+}
+
+/// <summary>
+///  Pops the oldest command (consumer only). The caller releases the body (see release).
+/// </summary>
+/// <param name="command">The command</param>
+/// <returns>True if a command was available</returns>
+bool CommandQueueClass::pop(Command& command)
+{
+	uint8_t h = head.load(std::memory_order_relaxed);
+
+	if (h == tail.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	command = slots[h];
+	head.store((h + 1) % SIZE, std::memory_order_release);
+	++Executed;
+
+	return true;
+}
+
+/// <summary>
+///  Returns the body of a popped command to the arena pool (consumer only).
+/// </summary>
+/// <param name="command">The command</param>
+void CommandQueueClass::release(Command& command)
+{
+	pool.release(command.Body);
+	command.Body = NULL;
+}
+
+/// <summary>
+///  Returns the number of queued commands (snapshot).
+/// </summary>
+/// <returns>The number of commands</returns>
+int CommandQueueClass::count()
+{
+	return (tail.load(std::memory_order_acquire) + SIZE - head.load(std::memory_order_acquire)) % SIZE;
+}
+
+/// <summary>
+///  Serialize the queue statistics to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String CommandQueueClass::serialize()
+{
+	StaticJsonDocument<JSON_OBJECT_SIZE(6)> doc;
+	String json;
+
+	doc["Size"] = SIZE - 1;
+	doc["Queued"] = count();
+	doc["Pushed"] = Pushed;
+	doc["Dropped"] = Dropped;
+	doc["Executed"] = Executed;
+	doc["MaxLatency"] = MaxLatency;
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
@@ -0,0 +1,91 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="CommandQueue.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <Arduino.h>
+
+#include "ArenaPool.h"
+#include "Leaderboard.h"
+
+/// <summary>
+/// The commands executed by the main task (loop).
+/// </summary>
+enum class CommandType : uint8_t
+{
+	ApplyApSettings,						// Apply and save the AP settings (body)
+	ApplyWiFiSettings,						// Apply and save the WiFi settings (body)
+	ApplyNetworks,							// Save the additional WiFi networks (body)
+	ApplyGameSettings,						// Apply and save the game settings (body)
+	Clear,									// Clear the non volatile storage
+	Reboot,									// Reboot (5 sec delay)
+	StartSmartConfig,						// Run the ESP32 SmartConfig
+	StartBenchmark,							// Run the file system benchmark
+	SetLedPattern,							// Set the on board LED pattern
+	SubmitScore								// Insert a player result into the leaderboard
+};
+
+/// <summary>
+/// The on board LED patterns.
+/// </summary>
+enum class LedPattern : uint8_t
+{
+	Running,								// Slow blinking (1 sec)
+	Busy,									// Fast blinking (250 msec)
+	Stopped									// Blinking with long pause (no network)
+};
+
+/// <summary>
+/// A command (POD). The body (if any) is copied into an arena block by the producer and released by the consumer.
+/// </summary>
+struct Command
+{
+	CommandType Type;						// The command type
+	LedPattern Pattern;						// The LED pattern (SetLedPattern)
+	bool MsgPack;							// True if the body is MessagePack encoded
+	uint16_t Length;						// The body length
+	uint8_t* Body;							// The request body (Apply commands, arena block)
+	LeaderboardEntry Entry;					// The player result (SubmitScore)
+};
+
+/// <summary>
+/// This class implements a lock-free single producer / single consumer command queue (ring buffer).
+/// The HTTP handlers (async_tcp task) push commands, the main task (loop) pops and executes them.
+/// The producer only writes the tail index, the consumer only writes the head index.
+/// </summary>
+class CommandQueueClass
+{
+public:
+	static const int SIZE = 8;				// The queue size (one slot is kept free)
+
+private:
+	ArenaPoolClass& pool;					// The pool holding the command bodies
+	Command slots[SIZE];					// The ring buffer
+	std::atomic<uint8_t> head;				// The next slot to pop (written by the consumer)
+	std::atomic<uint8_t> tail;				// The next slot to push (written by the producer)
+
+public:
+	uint32_t Pushed = 0;					// The total number of pushed commands (producer)
+	uint32_t Dropped = 0;					// The total number of commands dropped (queue or pool full)
+	uint32_t Executed = 0;					// The total number of executed commands (consumer)
+	uint32_t MaxLatency = 0;				// The maximum handler push time (microseconds)
+
+	CommandQueueClass(ArenaPoolClass& pool) : pool(pool), head(0), tail(0) {}
+
+	bool push(const Command& command);		// Push a command (producer)
+	bool push(CommandType type);			// Push a command without body (producer)
+	bool push(CommandType type, const uint8_t* data, size_t len, bool msgpack);	// Push a command with a copy of the body
+	bool push(LedPattern pattern);			// Push a SetLedPattern command (producer)
+	bool push(const LeaderboardEntry& entry);	// Push a SubmitScore command (producer)
+	bool pop(Command& command);				// Pop a command (consumer)
+	void release(Command& command);			// Release the body of a popped command (consumer)
+	int count();							// Returns the number of queued commands
+
+	String serialize();						// Return a string serialization (JSON)
+};
@@ -0,0 +1,206 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="ContentFormat.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <strings.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+
+#include "ContentFormat.h"
+
+const char* ContentFormatClass::JSON = "application/json";			// The JSON content type
+const char* ContentFormatClass::MSGPACK = "application/msgpack";	// The MessagePack content type
+
+/// <summary>
+///  Returns the quality (0..1000) of a media range of an Accept header ("type/subtype;q=0.5", 1000 if not given).
+/// </summary>
+/// <param name="params">The parameters following the media type (up to the next comma)</param>
+/// <param name="end">The end of the media range</param>
+/// <returns>The quality in thousandths</returns>
+static int quality(const char* params, const char* end)
+{
+	while ((params < end) && ((params = (const char*)memchr(params, ';', end - params)) != NULL))
+	{
+		++params;
+		while ((params < end) && (*params == ' ')) ++params;
+
+		if ((end - params >= 2) && ((params[0] == 'q') || (params[0] == 'Q')) && (params[1] == '='))
+		{
+			const char* p = params + 2;
+			int value = 0;
+			int scale = 1000;
+
+			if ((p < end) && (*p == '1')) return 1000;
+			if ((p < end) && (*p == '0')) ++p;
+			if ((p < end) && (*p == '.')) ++p;
+
+			while ((p < end) && (*p >= '0') && (*p <= '9') && (scale > 1))
+			{
+				scale /= 10;
+				value += (*p++ - '0') * scale;
+			}
+
+			return value;
+		}
+	}
+
+	return 1000;
+}
+
+/// <summary>
+///  Checks if the client accepts a MessagePack response (also "application/x-msgpack").
+///  The media ranges of the Accept header are parsed: MessagePack is selected if it is accepted with a
+///  quality above zero and at least the quality of JSON ("application/json", "application/*" or "*/*").
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <returns>True if MessagePack is accepted</returns>
+bool ContentFormatClass::acceptsMsgPack(AsyncWebServerRequest* request)
+{
+	AsyncWebHeader* header = request->getHeader("Accept");
+
+	if (header == NULL)
+	{
+		return false;
+	}
+
+	const char* p = header->value().c_str();
+	int msgpack = 0;
+	int json = 0;
+
+	while (*p != '\0')
+	{
+		while ((*p == ' ') || (*p == ',')) ++p;
+
+		const char* end = strchr(p, ',');
+		if (end == NULL) end = p + strlen(p);
+
+		const char* params = (const char*)memchr(p, ';', end - p);
+		const char* type = p;
+		size_t length = ((params != NULL) ? params : end) - p;
+
+		while ((length > 0) && (type[length - 1] == ' ')) --length;
+
+		int q = quality(type + length, end);
+
+		if (((length == 19) && (strncasecmp(type, "application/msgpack", 19) == 0)) ||
+			((length == 21) && (strncasecmp(type, "application/x-msgpack", 21) == 0)))
+		{
+			msgpack = max(msgpack, q);
+		}
+		else if (((length == 16) && (strncasecmp(type, "application/json", 16) == 0)) ||
+			((length == 13) && (strncasecmp(type, "application/*", 13) == 0)) ||
+			((length == 3) && (strncmp(type, "*/*", 3) == 0)))
+		{
+			json = max(json, q);
+		}
+
+		p = end;
+	}
+
+	return (msgpack > 0) && (msgpack >= json);
+}
+
+/// <summary>
+///  Checks if the request body is MessagePack encoded.
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <returns>True if the body is MessagePack</returns>
+bool ContentFormatClass::sendsMsgPack(AsyncWebServerRequest* request)
+{
+	return request->contentType().indexOf("msgpack") >= 0;
+}
+
+/// <summary>
+///  Sends the document in the format requested by the client (streamed, no intermediate string).
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <param name="code">The HTTP status code</param>
+/// <param name="doc">The JSON document</param>
+void ContentFormatClass::send(AsyncWebServerRequest* request, int code, JsonDocument& doc)
+{
+	bool msgpack = acceptsMsgPack(request);
+	AsyncResponseStream* response = request->beginResponseStream(msgpack ? MSGPACK : JSON);
+
+	response->setCode(code);
+	response->addHeader("Vary", "Accept");
+
+	if (msgpack)
+	{
+		serializeMsgPack(doc, *response);
+	}
+	else
+	{
+		serializeJsonPretty(doc, *response);
+	}
+
+	request->send(response);
+}
+
+/// <summary>
+///  Sends the document serialized into the request arena (no heap buffer). The response is sent from the arena,
+///  which is released when the request is done. If the arena is full the document is streamed instead.
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <param name="code">The HTTP status code</param>
+/// <param name="doc">The JSON document</param>
+/// <param name="arena">The request arena (see ArenaPoolClass::acquire)</param>
+void ContentFormatClass::send(AsyncWebServerRequest* request, int code, JsonDocument& doc, RequestArena* arena)
+{
+	bool msgpack = acceptsMsgPack(request);
+	size_t length = msgpack ? measureMsgPack(doc) : measureJsonPretty(doc);
+	char* buffer = (char*)arena->allocate(length + 1);
+
+	if (buffer == NULL)
+	{
+		send(request, code, doc);
+		return;
+	}
+
+	if (msgpack)
+	{
+		serializeMsgPack(doc, buffer, length + 1);
+	}
+	else
+	{
+		serializeJsonPretty(doc, buffer, length + 1);
+	}
+
+	AsyncWebServerResponse* response = request->beginResponse_P(code, msgpack ? MSGPACK : JSON, (const uint8_t*)buffer, length);
+	response->addHeader("Vary", "Accept");
+	request->send(response);
+}
+
+/// <summary>
+///  Parses the request body as JSON or MessagePack (depending on the content type).
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <param name="data">The body data</param>
+/// <param name="len">The body length</param>
+/// <param name="doc">The JSON document</param>
+/// <returns>True if successful (the caller checks the root type)</returns>
+bool ContentFormatClass::parse(AsyncWebServerRequest* request, uint8_t* data, size_t len, JsonDocument& doc)
+{
+	return parse(data, len, sendsMsgPack(request), doc);
+}
+
+/// <summary>
+///  Parses a (copied) request body as JSON or MessagePack.
+/// </summary>
+/// <param name="data">The body data</param>
+/// <param name="len">The body length</param>
+/// <param name="msgpack">True if the body is MessagePack encoded</param>
+/// <param name="doc">The JSON document</param>
+/// <returns>True if successful (the caller checks the root type)</returns>
+bool ContentFormatClass::parse(const uint8_t* data, size_t len, bool msgpack, JsonDocument& doc)
+{
+	DeserializationError err = msgpack ?
+		deserializeMsgPack(doc, (const char*)data, len) :
+		deserializeJson(doc, (const char*)data, len);
+
+	return !err;
+}
@@ -0,0 +1,35 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="ContentFormat.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+#include "ArenaPool.h"
+
+/// <summary>
+/// This class selects the wire format of the JSON endpoints.
+/// Responses are sent as MessagePack if the Accept header prefers "application/msgpack" (q-values honored),
+/// request bodies are parsed as MessagePack if sent with "Content-Type: application/msgpack".
+/// Otherwise (pretty printed) JSON is used.
+/// </summary>
+class ContentFormatClass
+{
+public:
+	static const char* JSON;					// The JSON content type
+	static const char* MSGPACK;					// The MessagePack content type
+
+	static bool acceptsMsgPack(AsyncWebServerRequest* request);		// Check the Accept header
+	static bool sendsMsgPack(AsyncWebServerRequest* request);		// Check the Content-Type header
+
+	static void send(AsyncWebServerRequest* request, int code, JsonDocument& doc);
+	static void send(AsyncWebServerRequest* request, int code, JsonDocument& doc, RequestArena* arena);
+	static bool parse(AsyncWebServerRequest* request, uint8_t* data, size_t len, JsonDocument& doc);
+	static bool parse(const uint8_t* data, size_t len, bool msgpack, JsonDocument& doc);
+};
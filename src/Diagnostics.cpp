@@ -0,0 +1,347 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Diagnostics.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+#include <ESP.h>
+
+#include "Diagnostics.h"
+
+const char* DiagnosticsClass::REASONS[] = {
+	"Unknown", "PowerOn", "External", "Software", "Panic", "InterruptWatchdog",
+	"TaskWatchdog", "Watchdog", "DeepSleep", "Brownout", "SDIO" };
+
+const char* DiagnosticsClass::CORE_REASONS[] = {
+	"NO_MEAN", "POWERON_RESET", "", "SW_RESET", "OWDT_RESET", "DEEPSLEEP_RESET", "SDIO_RESET",
+	"TG0WDT_SYS_RESET", "TG1WDT_SYS_RESET", "RTCWDT_SYS_RESET", "INTRUSION_RESET", "TGWDT_CPU_RESET",
+	"SW_CPU_RESET", "RTCWDT_CPU_RESET", "EXT_CPU_RESET", "RTCWDT_BROWN_OUT_RESET", "RTCWDT_RTC_RESET" };
+
+const char* DiagnosticsClass::CAUSES[] = { "None", "Command", "Update", "WiFi", "Reconfigure", "Sleep" };
+
+/// <summary>
+/// The diagnostic state kept in RTC memory (survives software resets, panics, watchdogs and deep sleep).
+/// </summary>
+struct DiagnosticsRtcState
+{
+	uint32_t Magic;							// The marker of a valid state
+	uint32_t Uptime;						// The uptime of the running firmware (sec)
+	uint32_t MinFreeHeap;					// The minimum free heap of the running firmware (bytes)
+	uint32_t Lost;							// The number of boots dropped before being saved
+	uint8_t Cause;							// The restart cause (RestartCause)
+	volatile uint8_t Probe;					// The running loop probe (see LoopMonitorClass::attach)
+	uint8_t Count;							// The number of boots not yet saved
+	BootRecord Pending[DiagnosticsClass::RTC_SIZE];	// The boots not yet saved (oldest first)
+};
+
+static const uint32_t RTC_MAGIC = 0x4B4E4F42;	// The marker of a valid state ("KNOB")
+static RTC_NOINIT_ATTR DiagnosticsRtcState rtc;
+
+/// <summary>
+///  Returns a name of a table (or "Unknown" if the index is out of range).
+/// </summary>
+template <size_t N>
+static const char* name(const char* (&names)[N], uint8_t index)
+{
+	return (index < N) ? names[index] : "Unknown";
+}
+
+/// <summary>
+///  Returns the name of a loop probe (or "None").
+/// </summary>
+static const char* probeName(uint8_t probe)
+{
+	return (probe < LoopMonitorClass::PROBES) ? LoopMonitorClass::NAMES[probe] : "None";
+}
+
+/// <summary>
+///  Captures the reset reasons and the previous run data from RTC memory (register and RTC memory access
+///  only, no storage or heap). Call this first in setup.
+/// </summary>
+void DiagnosticsClass::begin()
+{
+	uint32_t start = micros();
+	esp_reset_reason_t reason = esp_reset_reason();
+	bool valid = (rtc.Magic == RTC_MAGIC) && (rtc.Count <= RTC_SIZE) && (reason != ESP_RST_POWERON);
+
+	if (!valid)
+	{
+		rtc.Count = 0;
+		rtc.Lost = 0;
+	}
+
+	Current.Boot = 0;
+	Current.Reason = (uint8_t)reason;
+	Current.Core0 = (uint8_t)rtc_get_reset_reason(0);
+	Current.Core1 = (uint8_t)rtc_get_reset_reason(1);
+	Current.Known = valid;
+	Current.Uptime = valid ? rtc.Uptime : 0;
+	Current.MinFreeHeap = valid ? rtc.MinFreeHeap : 0;
+	Current.Cause = valid ? rtc.Cause : (uint8_t)RestartCause::None;
+	Current.Probe = valid ? rtc.Probe : NO_PROBE;
+
+	// Crashing again before the boots are saved drops the oldest boot.
+	if (rtc.Count == RTC_SIZE)
+	{
+		memmove(&rtc.Pending[0], &rtc.Pending[1], (RTC_SIZE - 1) * sizeof(BootRecord));
+		--rtc.Count;
+		++rtc.Lost;
+	}
+
+	rtc.Pending[rtc.Count++] = Current;
+	rtc.Magic = RTC_MAGIC;
+	rtc.Uptime = 0;
+	rtc.MinFreeHeap = 0;
+	rtc.Cause = (uint8_t)RestartCause::None;
+	rtc.Probe = NO_PROBE;
+
+	CaptureTime = micros() - start;
+}
+
+/// <summary>
+///  Updates the uptime and the minimum heap in RTC memory (once per second) and saves the boots
+///  captured since the last save (single blob write, once per boot).
+/// </summary>
+void DiagnosticsClass::update()
+{
+	if ((last == 0) || (millis() - last >= 1000))
+	{
+		refresh();
+	}
+
+	if (rtc.Count == 0)
+	{
+		return;
+	}
+
+	if (!loaded)
+	{
+		load();
+	}
+
+	Boots += rtc.Lost;
+	Lost = rtc.Lost;
+
+	for (int i = 0; i < rtc.Count; ++i)
+	{
+		BootRecord record = rtc.Pending[i];
+
+		// The RTC memory has been cleared (power-on), the data of a controlled shutdown is used instead.
+		if (!record.Known && shutdownRecord.Known && (i == 0))
+		{
+			record.Uptime = shutdownRecord.Uptime;
+			record.MinFreeHeap = shutdownRecord.MinFreeHeap;
+			record.Cause = shutdownRecord.Cause;
+			record.Probe = shutdownRecord.Probe;
+			record.Known = true;
+		}
+
+		shutdownRecord.Known = false;
+		record.Boot = ++Boots;
+
+		if (Count == SIZE)
+		{
+			memmove(&Records[0], &Records[1], (SIZE - 1) * sizeof(BootRecord));
+			--Count;
+		}
+
+		Records[Count++] = record;
+	}
+
+	Current = Records[Count - 1];
+	save();
+
+	rtc.Count = 0;
+	rtc.Lost = 0;
+}
+
+/// <summary>
+///  Records the cause of an intended restart in RTC memory (the first cause is kept).
+/// </summary>
+/// <param name="cause">The restart cause</param>
+void DiagnosticsClass::restarting(RestartCause cause)
+{
+	if (rtc.Cause == (uint8_t)RestartCause::None)
+	{
+		rtc.Cause = (uint8_t)cause;
+	}
+}
+
+/// <summary>
+///  Saves the uptime, heap and restart cause into the storage before a restart or deep sleep,
+///  so they are known after a power-on reset (which clears the RTC memory).
+/// </summary>
+void DiagnosticsClass::shutdown()
+{
+	if (!loaded)
+	{
+		load();
+	}
+
+	refresh();
+
+	shutdownRecord.Uptime = rtc.Uptime;
+	shutdownRecord.MinFreeHeap = rtc.MinFreeHeap;
+	shutdownRecord.Cause = rtc.Cause;
+	shutdownRecord.Probe = rtc.Probe;
+	shutdownRecord.Known = true;
+
+	save();
+}
+
+/// <summary>
+///  Returns the RTC memory cell holding the running loop probe (see LoopMonitorClass::attach).
+/// </summary>
+/// <returns>The probe cell</returns>
+volatile uint8_t* DiagnosticsClass::probe()
+{
+	return &rtc.Probe;
+}
+
+/// <summary>
+///  Writes the uptime and the minimum free heap into RTC memory.
+/// </summary>
+void DiagnosticsClass::refresh()
+{
+	last = millis();
+	rtc.Uptime = last / 1000;
+	rtc.MinFreeHeap = ESP.getMinFreeHeap();
+}
+
+/// <summary>
+///  Reads the ring of boots from the non volatile storage (single blob read).
+///  An invalid blob starts a new ring.
+/// </summary>
+void DiagnosticsClass::load()
+{
+	uint8_t buffer[BLOB_SIZE];
+	SettingsBlobHeader header;
+
+	preferences.begin(NAMESPACE, false);
+	size_t length = preferences.getBytes(KEY_BLOB, buffer, sizeof(buffer));
+	preferences.end();
+
+	loaded = true;
+	Count = 0;
+
+	if (length < sizeof(header) + sizeof(Boots) + sizeof(BootRecord))
+	{
+		return;
+	}
+
+	memcpy(&header, buffer, sizeof(header));
+	uint32_t crc = header.CRC;
+	header.CRC = 0;
+	memcpy(buffer, &header, sizeof(header));
+
+	if ((header.Version != VERSION) || (header.Count > SIZE) ||
+		(header.Length != length - sizeof(header)) ||
+		(header.Length != sizeof(Boots) + (header.Count + 1) * sizeof(BootRecord)) ||
+		(settingsCrc32(buffer, length) != crc))
+	{
+		return;
+	}
+
+	const uint8_t* p = buffer + sizeof(header);
+	memcpy(&Boots, p, sizeof(Boots));
+	p += sizeof(Boots);
+	memcpy(&shutdownRecord, p, sizeof(BootRecord));
+	p += sizeof(BootRecord);
+	memcpy(Records, p, header.Count * sizeof(BootRecord));
+	Count = header.Count;
+}
+
+/// <summary>
+///  Writes the ring of boots to the non volatile storage (single blob write).
+/// </summary>
+void DiagnosticsClass::save()
+{
+	uint8_t buffer[BLOB_SIZE];
+	uint8_t* p = buffer + sizeof(SettingsBlobHeader);
+
+	memcpy(p, &Boots, sizeof(Boots));
+	p += sizeof(Boots);
+	memcpy(p, &shutdownRecord, sizeof(BootRecord));
+	p += sizeof(BootRecord);
+	memcpy(p, Records, Count * sizeof(BootRecord));
+	p += Count * sizeof(BootRecord);
+
+	SettingsBlobHeader header;
+	header.CRC = 0;
+	header.Length = (uint16_t)(p - buffer - sizeof(SettingsBlobHeader));
+	header.Version = VERSION;
+	header.Count = (uint8_t)Count;
+	memcpy(buffer, &header, sizeof(header));
+	header.CRC = settingsCrc32(buffer, p - buffer);
+	memcpy(buffer, &header, sizeof(header));
+
+	preferences.begin(NAMESPACE, false);
+	preferences.putBytes(KEY_BLOB, buffer, p - buffer);
+	preferences.end();
+}
+
+/// <summary>
+///  Serialize the last boots (newest first) to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String DiagnosticsClass::serialize()
+{
+	StaticJsonDocument<CAPACITY> doc;
+	String json;
+
+	doc["Boots"] = Boots;
+	doc["Uptime"] = millis() / 1000;
+	doc["CaptureTime"] = CaptureTime;
+	doc["Lost"] = Lost;
+
+	JsonArray history = doc.createNestedArray("History");
+
+	for (int i = Count - 1; i >= 0; --i)
+	{
+		const BootRecord& record = Records[i];
+		JsonObject entry = history.createNestedObject();
+
+		entry["Boot"] = record.Boot;
+		entry["Reason"] = name(REASONS, record.Reason);
+		entry["Core0"] = name(CORE_REASONS, record.Core0);
+		entry["Core1"] = name(CORE_REASONS, record.Core1);
+
+		if (record.Known)
+		{
+			entry["Cause"] = name(CAUSES, record.Cause);
+			entry["Probe"] = probeName(record.Probe);
+			entry["Uptime"] = record.Uptime;
+			entry["MinFreeHeap"] = record.MinFreeHeap;
+		}
+	}
+
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Prints the current boot on the Serial stream.
+/// </summary>
+void DiagnosticsClass::print()
+{
+	Serial.println("Diagnostics:");
+	Serial.print("    Reason:      "); Serial.println(name(REASONS, Current.Reason));
+	Serial.print("    Core0:       "); Serial.println(name(CORE_REASONS, Current.Core0));
+	Serial.print("    Core1:       "); Serial.println(name(CORE_REASONS, Current.Core1));
+
+	if (Current.Known)
+	{
+		Serial.print("    Cause:       "); Serial.println(name(CAUSES, Current.Cause));
+		Serial.print("    Probe:       "); Serial.println(probeName(Current.Probe));
+		Serial.print("    Uptime:      "); Serial.println(Current.Uptime);
+		Serial.print("    MinFreeHeap: "); Serial.println(Current.MinFreeHeap);
+	}
+
+	Serial.print("    CaptureTime: "); Serial.println(CaptureTime);
+}
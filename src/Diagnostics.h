@@ -0,0 +1,100 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Diagnostics.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Preferences.h>
+#include <ArduinoJson.h>
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <rom/rtc.h>
+
+#include "SettingsBase.h"
+#include "LoopMonitor.h"
+
+/// <summary>
+/// The causes of an intended restart (recorded by the application before restarting).
+/// </summary>
+enum class RestartCause : uint8_t
+{
+	None,									// Not recorded (crash, watchdog, brownout, power or external reset)
+	Command,								// Reboot requested (see CommandType::Reboot)
+	Update,									// Firmware or file system update
+	WiFi,									// WiFi failure budget exhausted (see WiFiSupervisorClass)
+	Reconfigure,							// Access point not restarted with the new settings
+	Sleep									// Watchdog timer expired (deep sleep)
+};
+
+/// <summary>
+/// The diagnostic data of a boot (trivially copyable, kept in RTC memory until saved).
+/// </summary>
+struct BootRecord
+{
+	uint32_t Boot;							// The boot number (assigned when saved)
+	uint32_t Uptime;						// The uptime of the previous run (sec)
+	uint32_t MinFreeHeap;					// The minimum free heap of the previous run (bytes)
+	uint8_t Reason;							// The reset reason (esp_reset_reason_t)
+	uint8_t Core0;							// The reset reason of core 0 (RESET_REASON, see rom/rtc.h)
+	uint8_t Core1;							// The reset reason of core 1 (RESET_REASON, see rom/rtc.h)
+	uint8_t Cause;							// The restart cause recorded by the previous run (RestartCause)
+	uint8_t Probe;							// The loop probe running at the reset (LoopProbe or NO_PROBE)
+	bool Known;								// True if the previous run data (uptime, heap, cause, probe) is known
+};
+
+/// <summary>
+/// This class records the reset reasons of the last boots. At boot the reasons of both cores and the
+/// uptime, minimum heap, restart cause and running loop probe of the previous run are taken from RTC
+/// memory (no storage access). The main task saves them into a ring of the last boots in the non volatile
+/// storage. A power-on reset clears the RTC memory, then the data of a controlled shutdown (reboot or
+/// deep sleep, see shutdown()) is taken from the storage.
+/// </summary>
+class DiagnosticsClass
+{
+public:
+	static const uint8_t VERSION = 1;		// The blob schema version
+	static const int SIZE = 8;				// The number of boots kept in storage
+	static const int RTC_SIZE = 4;			// The number of boots kept in RTC memory until saved
+	static const uint8_t NO_PROBE = 0xFF;	// No loop probe running
+	static const int CAPACITY = JSON_OBJECT_SIZE(5) + JSON_ARRAY_SIZE(SIZE) + SIZE * JSON_OBJECT_SIZE(9);	// The JSON document capacity
+
+	static const char* REASONS[];			// The reset reason names (esp_reset_reason_t)
+	static const char* CORE_REASONS[];		// The core reset reason names (RESET_REASON)
+	static const char* CAUSES[];			// The restart cause names
+
+private:
+	static const int BLOB_SIZE = sizeof(SettingsBlobHeader) + sizeof(uint32_t) + (SIZE + 1) * sizeof(BootRecord);	// The maximum blob size
+
+	const char* NAMESPACE = "Diagnostics";	// The namespace used in preferences
+	const char* KEY_BLOB = "Boots";			// The preference key for the blob
+
+	Preferences preferences;				// The ESP32 preferences instance
+	BootRecord shutdownRecord = {};			// The previous run data saved by shutdown()
+	bool loaded = false;					// True if the storage has been read
+	uint32_t last = 0;						// The last RTC update (msec)
+
+	void load();							// Reads the ring from storage
+	void save();							// Writes the ring to storage
+	void refresh();							// Writes the uptime and heap into RTC memory
+
+public:
+	BootRecord Current = {};				// The current boot (captured by begin)
+	BootRecord Records[SIZE];				// The last boots (oldest first, the current boot last)
+	int Count = 0;							// The number of records
+	uint32_t Boots = 0;						// The total number of boots recorded
+	uint32_t Lost = 0;						// The number of boots not saved (RTC memory full)
+	uint32_t CaptureTime = 0;				// The capture time at boot (usec)
+
+	void begin();							// Captures the reset reasons (call first in setup)
+	void update();							// Saves the captured boots, updates the uptime (main task)
+	void restarting(RestartCause cause);	// Records the cause of an intended restart (the first cause is kept)
+	void shutdown();						// Saves the uptime before a restart or deep sleep (main task)
+	volatile uint8_t* probe();				// Returns the RTC cell of the running loop probe
+
+	String serialize();						// Return a string serialization (JSON)
+	void print();							// Prints the current boot on the serial line
+};
@@ -0,0 +1,176 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="FileSystem.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+
+#include "FileSystem.h"
+
+#ifdef KNOBLOMAT_LITTLEFS
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 2)
+#include <LittleFS.h>
+#define FILESYSTEM LittleFS
+#else
+#include <LITTLEFS.h>
+#define FILESYSTEM LITTLEFS
+#endif
+const char* FileSystemClass::NAME = "LittleFS";
+#else
+#include <SPIFFS.h>
+#define FILESYSTEM SPIFFS
+const char* FileSystemClass::NAME = "SPIFFS";
+#endif
+
+/// <summary>
+///  Returns the file system instance of the selected backend.
+/// </summary>
+fs::FS& FileSystemClass::fs()
+{
+	return FILESYSTEM;
+}
+
+/// <summary>
+///  Mounts the file system and measures the mount time.
+/// </summary>
+/// <returns>True if successful</returns>
+bool FileSystemClass::begin()
+{
+	uint32_t start = micros();
+	bool ok = FILESYSTEM.begin();
+	MountTime = micros() - start;
+
+	return ok;
+}
+
+/// <summary>
+///  Unmounts the file system.
+/// </summary>
+void FileSystemClass::end()
+{
+	FILESYSTEM.end();
+}
+
+/// <summary>
+///  Prints the file system content on the serial line.
+/// </summary>
+void FileSystemClass::list()
+{
+	Serial.print(NAME); Serial.println(" content:");
+	File root = FILESYSTEM.open("/");
+	File file = root.openNextFile();
+
+	while (file) {
+		Serial.println("\t" + String(file.name()) + ", " + String(file.size()) + " bytes");
+		file = root.openNextFile();
+	}
+}
+
+/// <summary>
+///  Opens and sequentially reads all files, measuring the open latency and the read throughput.
+/// </summary>
+void FileSystemClass::benchmark()
+{
+	Files = 0;
+	Bytes = 0;
+	OpenTime = 0;
+	OpenMax = 0;
+	ReadTime = 0;
+
+	walk(FILESYSTEM.open("/"));
+}
+
+/// <summary>
+///  Benchmarks all files in a directory (LittleFS has real directories, SPIFFS lists all files in the root).
+/// </summary>
+/// <param name="dir">The directory</param>
+void FileSystemClass::walk(fs::File dir)
+{
+	static uint8_t buffer[1024];
+	fs::File entry = dir.openNextFile();
+
+	while (entry)
+	{
+		if (entry.isDirectory())
+		{
+			walk(entry);
+		}
+		else
+		{
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 2)
+			String path = String(entry.path());
+#else
+			String path = String(entry.name());
+#endif
+			entry.close();
+
+			uint32_t start = micros();
+			fs::File file = FILESYSTEM.open(path, "r");
+			uint32_t open = micros() - start;
+
+			if (file)
+			{
+				OpenTime += open;
+				if (open > OpenMax) OpenMax = open;
+
+				start = micros();
+				size_t n;
+
+				while ((n = file.read(buffer, sizeof(buffer))) > 0)
+				{
+					Bytes += n;
+				}
+
+				ReadTime += micros() - start;
+				++Files;
+				file.close();
+			}
+		}
+
+		entry = dir.openNextFile();
+	}
+}
+
+/// <summary>
+///  Serialize the FileSystemClass instance to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String FileSystemClass::serialize()
+{
+	const int capacity = JSON_OBJECT_SIZE(9);
+	StaticJsonDocument<capacity> doc;
+	String json;
+
+	doc["Backend"] = NAME;
+	doc["MountTime"] = MountTime;
+	doc["Files"] = Files;
+	doc["Bytes"] = Bytes;
+	doc["OpenAverage"] = (Files > 0) ? OpenTime / Files : 0;
+	doc["OpenMax"] = OpenMax;
+	doc["ReadTime"] = ReadTime;
+	doc["Throughput"] = (ReadTime > 0) ? (uint32_t)((uint64_t)Bytes * 1000000 / ReadTime) : 0;
+
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Prints the FileSystemClass instance data on the Serial stream.
+/// </summary>
+void FileSystemClass::print()
+{
+	Serial.println("File System Benchmark:");
+	Serial.print("    Backend:        "); Serial.println(NAME);
+	Serial.print("    MountTime(us):  "); Serial.println(MountTime);
+	Serial.print("    Files:          "); Serial.println(Files);
+	Serial.print("    Bytes:          "); Serial.println(Bytes);
+	Serial.print("    OpenAverage(us):"); Serial.println((Files > 0) ? OpenTime / Files : 0);
+	Serial.print("    OpenMax(us):    "); Serial.println(OpenMax);
+	Serial.print("    ReadTime(us):   "); Serial.println(ReadTime);
+}
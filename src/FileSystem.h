@@ -0,0 +1,45 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="FileSystem.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <FS.h>
+
+// Select the file system backend at build time (default: SPIFFS).
+// Note that the data/ image has to be built with the matching tool (mkspiffs or mklittlefs).
+// #define KNOBLOMAT_LITTLEFS
+
+/// <summary>
+/// This class wraps the file system backend used by the web handlers (SPIFFS or LittleFS),
+/// and runs a benchmark measuring the mount time, the open latency and the sequential read throughput.
+/// </summary>
+class FileSystemClass
+{
+private:
+	void walk(fs::File dir);					// Benchmarks all files in a directory (recursive)
+
+public:
+	static const char* NAME;					// The backend name
+
+	fs::FS& fs();								// The file system instance
+
+	bool begin();								// Mounts the file system (measures the mount time)
+	void end();									// Unmounts the file system
+	void list();								// Prints the file system content on the serial line
+	void benchmark();							// Opens and reads all files
+
+	uint32_t MountTime = 0;						// The mount time (usec)
+	int Files = 0;								// The number of files read
+	uint32_t Bytes = 0;							// The number of bytes read
+	uint32_t OpenTime = 0;						// The total open time (usec)
+	uint32_t OpenMax = 0;						// The maximum open time (usec)
+	uint32_t ReadTime = 0;						// The total read time (usec)
+
+	String serialize();							// Return a string serialization (JSON)
+	void print();								// Prints all fields on the serial line
+};
@@ -0,0 +1,110 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="FixedString.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <Arduino.h>
+#include <IPAddress.h>
+
+/// <summary>
+/// A string of up to N characters stored inline (no heap allocation). Longer texts are truncated on
+/// assignment. The type is trivially copyable, so it can be embedded in settings, info and POD structures.
+/// With ArduinoJson pass buffer() to copy the text into the document, c_str() to store a pointer only.
+/// With Preferences use getString(key, buffer(), size()) and putString(key, c_str()).
+/// </summary>
+template <size_t N>
+class FixedString
+{
+private:
+	char text[N + 1];						// The characters (zero terminated)
+
+public:
+	FixedString() { text[0] = '\0'; }
+	FixedString(const char* value) { assign(value); }
+	FixedString(const String& value) { assign(value.c_str(), value.length()); }
+
+	FixedString& operator=(const char* value) { return assign(value); }
+	FixedString& operator=(const String& value) { return assign(value.c_str(), value.length()); }
+
+	template <size_t M>
+	FixedString& operator=(const FixedString<M>& value) { return assign(value.c_str()); }
+
+	/// <summary>
+	///  Copies a text (truncated to N characters, NULL clears the string).
+	/// </summary>
+	FixedString& assign(const char* value)
+	{
+		return assign(value, (value != NULL) ? strnlen(value, N) : 0);
+	}
+
+	/// <summary>
+	///  Copies a text of the given length (truncated to N characters).
+	/// </summary>
+	FixedString& assign(const char* value, size_t length)
+	{
+		if (length > N) length = N;
+		memmove(text, value, length);
+		text[length] = '\0';
+		return *this;
+	}
+
+	/// <summary>
+	///  Formats a text (printf style, truncated to N characters).
+	/// </summary>
+	FixedString& format(const char* format, ...)
+	{
+		va_list args;
+		va_start(args, format);
+		vsnprintf(text, sizeof(text), format, args);
+		va_end(args);
+		return *this;
+	}
+
+	const char* c_str() const { return text; }				// The text (stored by ArduinoJson as a pointer)
+	char* buffer() { return text; }							// The buffer (copied by ArduinoJson)
+	size_t length() const { return strlen(text); }			// The number of characters
+	static constexpr size_t size() { return N + 1; }		// The buffer size (including the zero)
+	static constexpr size_t capacity() { return N; }		// The maximum number of characters
+
+	bool operator==(const char* value) const { return strcmp(text, (value != NULL) ? value : "") == 0; }
+	bool operator!=(const char* value) const { return !(*this == value); }
+	bool operator==(const String& value) const { return *this == value.c_str(); }
+	bool operator!=(const String& value) const { return !(*this == value.c_str()); }
+
+	template <size_t M>
+	bool operator==(const FixedString<M>& value) const { return *this == value.c_str(); }
+
+	template <size_t M>
+	bool operator!=(const FixedString<M>& value) const { return !(*this == value.c_str()); }
+};
+
+/// <summary>
+///  Formats an IP address into a fixed string without allocating a String (dotted decimal).
+/// </summary>
+template <size_t N>
+FixedString<N>& formatAddress(FixedString<N>& text, const IPAddress& address)
+{
+	return text.format("%u.%u.%u.%u", address[0], address[1], address[2], address[3]);
+}
+
+/// <summary>
+///  Formats a MAC address into a fixed string without allocating a String (empty if NULL).
+/// </summary>
+template <size_t N>
+FixedString<N>& formatMAC(FixedString<N>& text, const uint8_t* mac)
+{
+	if (mac == NULL)
+	{
+		return text.assign(NULL);
+	}
+
+	return text.format("%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+}
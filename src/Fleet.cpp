@@ -0,0 +1,561 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Fleet.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#endif
+
+#include "Fleet.h"
+
+/// <summary>
+///  Writes a 32 bit value (little endian).
+/// </summary>
+static uint8_t* put32(uint8_t* p, uint32_t value)
+{
+	p[0] = (uint8_t)value;
+	p[1] = (uint8_t)(value >> 8);
+	p[2] = (uint8_t)(value >> 16);
+	p[3] = (uint8_t)(value >> 24);
+	return p + 4;
+}
+
+/// <summary>
+///  Reads a 32 bit value (little endian).
+/// </summary>
+static uint32_t get32(const uint8_t* p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/// <summary>
+///  Initializes the peer table.
+/// </summary>
+FleetClass::FleetClass()
+{
+	memset(&self, 0, sizeof(self));
+	memset(&sent, 0, sizeof(sent));
+	memset(peers, 0, sizeof(peers));
+}
+
+/// <summary>
+///  Returns the current time in milliseconds.
+/// </summary>
+uint32_t FleetClass::now()
+{
+#ifdef ARDUINO
+	return millis();
+#else
+	using namespace std::chrono;
+	return (uint32_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/// <summary>
+///  Joins the multicast group and announces the device (full update).
+/// </summary>
+/// <param name="transport">The datagram transport</param>
+/// <param name="node">The unique node ID (e.g. from the MAC address)</param>
+/// <param name="name">The hostname (truncated to 15 characters)</param>
+/// <returns>True if successful</returns>
+bool FleetClass::begin(FleetTransport* transport, uint32_t node, const char* name)
+{
+	this->transport = transport;
+	self.Node = node;
+	self.Valid = true;
+	snprintf(self.Name, sizeof(self.Name), "%s", name);
+
+	if (!transport->begin(GROUP, PORT))
+	{
+		this->transport = nullptr;
+		return false;
+	}
+
+	announce = true;
+	return true;
+}
+
+/// <summary>
+///  Polls the received datagrams, sends a delta update if the totals changed, sends a full update
+///  if due and drops silent peers. Called periodically by the main task (never blocks).
+/// </summary>
+/// <param name="score">The local totals</param>
+void FleetClass::update(const FleetScore& score)
+{
+	if (transport == nullptr)
+	{
+		return;
+	}
+
+	uint8_t packet[PACKET_SIZE];
+	uint32_t address;
+	uint32_t time = now();
+	int len;
+
+	while ((len = transport->receive(packet, sizeof(packet), address)) > 0)
+	{
+		handle(packet, (size_t)len, address, time);
+	}
+
+	lock.lock();
+	self.Score = score;
+	self.LastSeen = time;
+	lock.unlock();
+
+	if ((time - lastFull >= FULL_INTERVAL) || (announce && (time - lastFull >= ANNOUNCE_DELAY)))
+	{
+		send(FLAG_FULL | FLAG_TIES | FLAG_WINS | FLAG_LOSSES);
+		lastFull = time;
+		announce = false;
+	}
+	else
+	{
+		uint8_t flags = ((score.Ties != sent.Ties) ? FLAG_TIES : 0) |
+			((score.Wins != sent.Wins) ? FLAG_WINS : 0) |
+			((score.Losses != sent.Losses) ? FLAG_LOSSES : 0);
+
+		if (flags != 0)
+		{
+			send(flags);
+		}
+	}
+
+	expire(time);
+}
+
+/// <summary>
+///  Encodes an update datagram.
+/// </summary>
+/// <param name="packet">The datagram buffer (PACKET_SIZE bytes)</param>
+/// <param name="peer">The entry to send</param>
+/// <param name="flags">The update flags</param>
+/// <returns>The datagram length</returns>
+size_t FleetClass::encode(uint8_t* packet, const FleetPeer& peer, uint8_t flags)
+{
+	uint8_t* p = packet;
+
+	*p++ = 'K';
+	*p++ = 'F';
+	*p++ = VERSION;
+	*p++ = flags;
+	p = put32(p, peer.Node);
+	*p++ = (uint8_t)peer.Sequence;
+	*p++ = (uint8_t)(peer.Sequence >> 8);
+
+	if (flags & FLAG_FULL)
+	{
+		size_t length = strnlen(peer.Name, sizeof(peer.Name) - 1);
+		*p++ = (uint8_t)length;
+		memcpy(p, peer.Name, length);
+		p += length;
+	}
+
+	if (flags & FLAG_TIES) p = put32(p, peer.Score.Ties);
+	if (flags & FLAG_WINS) p = put32(p, peer.Score.Wins);
+	if (flags & FLAG_LOSSES) p = put32(p, peer.Score.Losses);
+
+	return p - packet;
+}
+
+/// <summary>
+///  Sends a full or delta update with the next sequence number.
+/// </summary>
+/// <param name="flags">The update flags</param>
+void FleetClass::send(uint8_t flags)
+{
+	uint8_t packet[PACKET_SIZE];
+
+	++self.Sequence;
+	size_t len = encode(packet, self, flags);
+
+	if (transport->send(packet, len))
+	{
+		++Sent;
+		BytesSent += len;
+	}
+
+	sent = self.Score;
+}
+
+/// <summary>
+///  Decodes a datagram and updates the peer table. Delta updates carry absolute values, so they are
+///  applied even after a gap in the sequence numbers (the peer is marked stale until the next full update).
+///  A full update is always applied and restarts the sequence (a rebooted peer counts from 1 again).
+/// </summary>
+/// <param name="packet">The datagram</param>
+/// <param name="len">The datagram length</param>
+/// <param name="address">The sender address</param>
+/// <param name="time">The current time (msec)</param>
+void FleetClass::handle(const uint8_t* packet, size_t len, uint32_t address, uint32_t time)
+{
+	++Received;
+
+	if ((len < 10) || (packet[0] != 'K') || (packet[1] != 'F') || (packet[2] != VERSION))
+	{
+		++Dropped;
+		return;
+	}
+
+	uint8_t flags = packet[3];
+	uint32_t node = get32(packet + 4);
+	uint16_t number = (uint16_t)(packet[8] | (packet[9] << 8));
+	const uint8_t* p = packet + 10;
+	const uint8_t* end = packet + len;
+
+	if ((node == 0) || (node == self.Node))
+	{
+		return;
+	}
+
+	char name[sizeof(self.Name)] = "";
+
+	if (flags & FLAG_FULL)
+	{
+		if ((p >= end) || (*p >= sizeof(name)) || (p + 1 + *p > end))
+		{
+			++Dropped;
+			return;
+		}
+
+		memcpy(name, p + 1, *p);
+		name[*p] = '\0';
+		p += 1 + *p;
+	}
+
+	int fields = ((flags & FLAG_TIES) ? 1 : 0) + ((flags & FLAG_WINS) ? 1 : 0) + ((flags & FLAG_LOSSES) ? 1 : 0);
+
+	if (end - p != fields * 4)
+	{
+		++Dropped;
+		return;
+	}
+
+	FleetPeer* peer = find(node, address);
+	bool known = (peer != nullptr) && (peer->Node == node);
+
+	if (known)
+	{
+		// Any datagram shows the peer is alive, even an outdated one.
+		lock.lock();
+		peer->LastSeen = time;
+		lock.unlock();
+	}
+
+	if (known && !(flags & FLAG_FULL) && ((int16_t)(number - peer->Sequence) <= 0))
+	{
+		++Dropped;
+		return;
+	}
+
+	if (!(flags & FLAG_FULL) && !known)
+	{
+		// Delta from an unknown peer: wait for its next full update.
+		++Dropped;
+		return;
+	}
+
+	lock.lock();
+
+	if (peer == nullptr)
+	{
+		peer = allocate();
+		memset(peer, 0, sizeof(FleetPeer));
+		announce = true;
+	}
+
+	peer->Stale = known && !(flags & FLAG_FULL) && (number != (uint16_t)(peer->Sequence + 1));
+	peer->Node = node;
+	peer->Address = address;
+	peer->Sequence = number;
+	peer->LastSeen = time;
+
+	if (flags & FLAG_FULL)
+	{
+		memcpy(peer->Name, name, sizeof(peer->Name));
+		peer->Valid = true;
+	}
+	else
+	{
+		++Deltas;
+	}
+
+	if (flags & FLAG_TIES) { peer->Score.Ties = get32(p); p += 4; }
+	if (flags & FLAG_WINS) { peer->Score.Wins = get32(p); p += 4; }
+	if (flags & FLAG_LOSSES) { peer->Score.Losses = get32(p); p += 4; }
+
+	lock.unlock();
+}
+
+/// <summary>
+///  Adds a peer announced by mDNS (shown once its first full update has been received).
+/// </summary>
+/// <param name="address">The peer address (network byte order)</param>
+/// <param name="name">The peer hostname</param>
+void FleetClass::discover(uint32_t address, const char* name)
+{
+	if (find(0, address) != nullptr)
+	{
+		return;
+	}
+
+	uint32_t time = now();
+
+	lock.lock();
+	FleetPeer* peer = allocate();
+	memset(peer, 0, sizeof(FleetPeer));
+	peer->Address = address;
+	peer->LastSeen = time;
+	snprintf(peer->Name, sizeof(peer->Name), "%s", name);
+	lock.unlock();
+
+	// Announce ourselves so the new peer learns our totals without waiting for the next full update.
+	announce = true;
+}
+
+/// <summary>
+///  Finds a peer by node ID, or a discovered peer (node 0) by address.
+/// </summary>
+/// <param name="node">The node ID (0 to match the address only)</param>
+/// <param name="address">The peer address</param>
+/// <returns>The peer or nullptr</returns>
+FleetPeer* FleetClass::find(uint32_t node, uint32_t address)
+{
+	FleetPeer* discovered = nullptr;
+
+	for (int i = 0; i < MAX_PEERS; ++i)
+	{
+		if ((node != 0) && (peers[i].Node == node))
+		{
+			return &peers[i];
+		}
+
+		if ((peers[i].LastSeen != 0) && (peers[i].Address == address) && ((peers[i].Node == 0) || (node == 0)))
+		{
+			discovered = &peers[i];
+		}
+	}
+
+	return discovered;
+}
+
+/// <summary>
+///  Returns a free entry, or the entry silent for the longest time if the table is full.
+/// </summary>
+/// <returns>The entry</returns>
+FleetPeer* FleetClass::allocate()
+{
+	FleetPeer* oldest = &peers[0];
+
+	for (int i = 0; i < MAX_PEERS; ++i)
+	{
+		if (peers[i].LastSeen == 0)
+		{
+			return &peers[i];
+		}
+
+		if ((int32_t)(peers[i].LastSeen - oldest->LastSeen) < 0)
+		{
+			oldest = &peers[i];
+		}
+	}
+
+	return oldest;
+}
+
+/// <summary>
+///  Drops the peers silent for more than PEER_TIMEOUT.
+/// </summary>
+/// <param name="time">The current time (msec)</param>
+void FleetClass::expire(uint32_t time)
+{
+	for (int i = 0; i < MAX_PEERS; ++i)
+	{
+		if ((peers[i].LastSeen != 0) && (time - peers[i].LastSeen > PEER_TIMEOUT))
+		{
+			lock.lock();
+			memset(&peers[i], 0, sizeof(FleetPeer));
+			lock.unlock();
+		}
+	}
+}
+
+/// <summary>
+///  Returns the number of peers with known totals.
+/// </summary>
+int FleetClass::count()
+{
+	FleetPeer entries[MAX_PEERS + 1];
+	return leaderboard(entries, MAX_PEERS + 1) - 1;
+}
+
+/// <summary>
+///  Copies the local entry and all peers with known totals, sorted by wins (then ties) descending.
+///  Safe to call from any task (the entries are copied under the lock, sorted outside).
+/// </summary>
+/// <param name="entries">The entry buffer</param>
+/// <param name="size">The buffer size (MAX_PEERS + 1 for all entries)</param>
+/// <returns>The number of entries</returns>
+int FleetClass::leaderboard(FleetPeer* entries, int size)
+{
+	int n = 0;
+
+	lock.lock();
+
+	if (size > 0)
+	{
+		entries[n++] = self;
+	}
+
+	for (int i = 0; (i < MAX_PEERS) && (n < size); ++i)
+	{
+		if (peers[i].Valid)
+		{
+			entries[n++] = peers[i];
+		}
+	}
+
+	lock.unlock();
+
+	// Insertion sort (small table).
+	for (int i = 1; i < n; ++i)
+	{
+		FleetPeer entry = entries[i];
+		int j = i - 1;
+
+		while ((j >= 0) && ((entries[j].Score.Wins < entry.Score.Wins) ||
+			((entries[j].Score.Wins == entry.Score.Wins) && (entries[j].Score.Ties < entry.Score.Ties))))
+		{
+			entries[j + 1] = entries[j];
+			--j;
+		}
+
+		entries[j + 1] = entry;
+	}
+
+	return n;
+}
+
+/// <summary>
+///  Sums the totals of the entries.
+/// </summary>
+/// <param name="entries">The entries</param>
+/// <param name="count">The number of entries</param>
+/// <returns>The fleet totals</returns>
+FleetScore FleetClass::total(const FleetPeer* entries, int count)
+{
+	FleetScore score = { 0, 0, 0 };
+
+	for (int i = 0; i < count; ++i)
+	{
+		score.Ties += entries[i].Score.Ties;
+		score.Wins += entries[i].Score.Wins;
+		score.Losses += entries[i].Score.Losses;
+	}
+
+	return score;
+}
+
+#ifndef ARDUINO
+/// <summary>
+///  Closes the socket.
+/// </summary>
+SocketFleetTransport::~SocketFleetTransport()
+{
+	if (socket >= 0)
+	{
+		close(socket);
+	}
+}
+
+/// <summary>
+///  Opens a non-blocking UDP socket, joins the multicast group and enables the loopback.
+/// </summary>
+bool SocketFleetTransport::begin(uint32_t group, uint16_t port)
+{
+	this->group = group;
+	this->port = port;
+
+	socket = ::socket(AF_INET, SOCK_DGRAM, 0);
+
+	if (socket < 0)
+	{
+		return false;
+	}
+
+	int on = 1;
+	setsockopt(socket, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+#ifdef SO_REUSEPORT
+	setsockopt(socket, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on));
+#endif
+
+	sockaddr_in local = {};
+	local.sin_family = AF_INET;
+	local.sin_port = htons(port);
+	local.sin_addr.s_addr = htonl(INADDR_ANY);
+
+	if (bind(socket, (sockaddr*)&local, sizeof(local)) < 0)
+	{
+		return false;
+	}
+
+	ip_mreq membership = {};
+	membership.imr_multiaddr.s_addr = group;
+	membership.imr_interface.s_addr = htonl(INADDR_ANY);
+
+	if (setsockopt(socket, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) < 0)
+	{
+		return false;
+	}
+
+	unsigned char loop = 1;
+	setsockopt(socket, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+	fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK);
+
+	return true;
+}
+
+/// <summary>
+///  Sends a datagram to the multicast group.
+/// </summary>
+bool SocketFleetTransport::send(const uint8_t* data, size_t len)
+{
+	sockaddr_in remote = {};
+	remote.sin_family = AF_INET;
+	remote.sin_port = htons(port);
+	remote.sin_addr.s_addr = group;
+
+	return sendto(socket, data, len, 0, (sockaddr*)&remote, sizeof(remote)) == (ssize_t)len;
+}
+
+/// <summary>
+///  Receives a pending datagram (returns 0 if none).
+/// </summary>
+int SocketFleetTransport::receive(uint8_t* data, size_t size, uint32_t& address)
+{
+	sockaddr_in remote = {};
+	socklen_t length = sizeof(remote);
+	ssize_t len = recvfrom(socket, data, size, 0, (sockaddr*)&remote, &length);
+
+	if (len <= 0)
+	{
+		return 0;
+	}
+
+	address = remote.sin_addr.s_addr;
+	return (int)len;
+}
+#endif
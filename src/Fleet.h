@@ -0,0 +1,139 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Fleet.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SnapshotLock.h"
+
+/// <summary>
+/// The datagram transport of the fleet gossip (UDP multicast on the ESP32 or a socket on the host).
+/// Addresses are IPv4 addresses in network byte order.
+/// </summary>
+class FleetTransport
+{
+public:
+	virtual ~FleetTransport() {}
+
+	virtual bool begin(uint32_t group, uint16_t port) = 0;				// Joins the multicast group
+	virtual bool send(const uint8_t* data, size_t len) = 0;				// Sends a datagram to the group
+	virtual int receive(uint8_t* data, size_t size, uint32_t& address) = 0;	// Polls a datagram (0 if none)
+};
+
+#ifndef ARDUINO
+/// <summary>
+/// A POSIX socket transport (host builds). Several instances on one host share the port
+/// (SO_REUSEADDR) and receive their own multicast datagrams (IP_MULTICAST_LOOP).
+/// </summary>
+class SocketFleetTransport : public FleetTransport
+{
+private:
+	int socket = -1;													// The UDP socket
+	uint32_t group = 0;													// The multicast group
+	uint16_t port = 0;													// The UDP port
+
+public:
+	~SocketFleetTransport();
+
+	bool begin(uint32_t group, uint16_t port) override;
+	bool send(const uint8_t* data, size_t len) override;
+	int receive(uint8_t* data, size_t size, uint32_t& address) override;
+};
+#endif
+
+/// <summary>
+/// The game totals of a Knoblomat (see GameSettingsClass).
+/// </summary>
+struct FleetScore
+{
+	uint32_t Ties;														// The total number of ties
+	uint32_t Wins;														// The total number of wins
+	uint32_t Losses;													// The total number of losses
+};
+
+/// <summary>
+/// An entry of the peer table (plain old data).
+/// </summary>
+struct FleetPeer
+{
+	uint32_t Node;														// The node ID (0 if discovered only)
+	uint32_t Address;													// The IPv4 address (network byte order)
+	char Name[24];														// The device name (access point SSID)
+	FleetScore Score;													// The last known totals
+	uint16_t Sequence;													// The last received sequence number
+	uint32_t LastSeen;													// The time of the last datagram (msec)
+	bool Valid;															// The totals have been received (full update)
+	bool Stale;															// A delta update has been missed
+};
+
+/// <summary>
+/// This class shares the game totals between the Knoblomats of a local network.
+/// Every device multicasts a compact binary summary: a delta update (changed totals only) when
+/// its totals change and a full update every 30 seconds (or when a new peer shows up).
+/// The received summaries are kept in a fixed size peer table, peers are dropped after 95 seconds
+/// of silence. Peers announced by mDNS are added before their first summary arrives.
+/// The table is written by the main task and copied under a short critical section (see SnapshotLock).
+///
+/// Datagram layout (little endian):
+///     'K' 'F' version flags node(4) sequence(2) [length name] [ties(4)] [wins(4)] [losses(4)]
+/// The name is sent with full updates only, the totals are present if the flag bit is set.
+/// </summary>
+class FleetClass
+{
+public:
+	static const uint8_t VERSION = 1;									// The datagram version
+	static const uint16_t PORT = 4210;									// The UDP port
+	static const uint32_t GROUP = 0x2A2A2AEF;							// The multicast group 239.42.42.42 (network byte order, little endian host)
+	static const int MAX_PEERS = 16;									// The size of the peer table
+	static const size_t PACKET_SIZE = 48;								// The maximum datagram size
+	static const uint32_t FULL_INTERVAL = 30000;						// The full update interval (msec)
+	static const uint32_t ANNOUNCE_DELAY = 1000;						// The minimum delay between full updates (msec)
+	static const uint32_t PEER_TIMEOUT = 95000;							// The peer timeout (msec)
+
+	static const uint8_t FLAG_TIES = 0x01;								// The ties are present
+	static const uint8_t FLAG_WINS = 0x02;								// The wins are present
+	static const uint8_t FLAG_LOSSES = 0x04;							// The losses are present
+	static const uint8_t FLAG_FULL = 0x80;								// Full update (with name)
+
+private:
+	FleetTransport* transport = nullptr;								// The datagram transport
+	FleetPeer self;														// The local entry
+	FleetScore sent;													// The totals last sent
+	uint32_t lastFull = 0;												// The time of the last full update (msec)
+	bool announce = false;												// Send a full update soon
+	FleetPeer peers[MAX_PEERS];											// The peer table
+	SnapshotLock lock;													// Guards the table and the local totals
+
+	void send(uint8_t flags);											// Sends a full or delta update
+	void handle(const uint8_t* packet, size_t len, uint32_t address, uint32_t now);
+	FleetPeer* find(uint32_t node, uint32_t address);					// Finds a peer
+	FleetPeer* allocate();												// Finds a free (or the oldest) entry
+	void expire(uint32_t now);											// Drops silent peers
+
+public:
+	uint32_t Sent = 0;													// The number of datagrams sent
+	uint32_t BytesSent = 0;												// The number of bytes sent
+	uint32_t Received = 0;												// The number of datagrams received
+	uint32_t Deltas = 0;												// The number of delta updates received
+	uint32_t Dropped = 0;												// The number of invalid or outdated datagrams
+
+	FleetClass();
+
+	bool begin(FleetTransport* transport, uint32_t node, const char* name);
+	void update(const FleetScore& score);								// Polls, sends updates and expires peers
+	void discover(uint32_t address, const char* name);					// Adds a peer announced by mDNS
+
+	int count();														// The number of peers (snapshot)
+	int leaderboard(FleetPeer* entries, int size);						// Copies self and peers sorted by wins
+	FleetScore total(const FleetPeer* entries, int count);				// Sums the totals of the entries
+
+	static size_t encode(uint8_t* packet, const FleetPeer& peer, uint8_t flags);
+	static uint32_t now();												// The current time (msec)
+};
@@ -0,0 +1,92 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="FleetInfo.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+
+#include "FleetInfo.h"
+
+/// <summary>
+///  Using a FleetClass instance to get the actual leaderboard.
+/// </summary>
+/// <param name="fleet">The FleetClass instance</param>
+FleetInfoClass::FleetInfoClass(FleetClass& fleet)
+{
+	Count = fleet.leaderboard(Entries, FleetClass::MAX_PEERS + 1);
+	Total = fleet.total(Entries, Count);
+	Sent = fleet.Sent;
+	BytesSent = fleet.BytesSent;
+	Received = fleet.Received;
+	Deltas = fleet.Deltas;
+	Dropped = fleet.Dropped;
+}
+
+/// <summary>
+///  Serialize the FleetInfoClass instance to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String FleetInfoClass::serialize()
+{
+	StaticJsonDocument<CAPACITY> doc;
+	String json;
+
+	doc["Devices"] = Count;
+	doc["Sent"] = Sent;
+	doc["BytesSent"] = BytesSent;
+	doc["Received"] = Received;
+	doc["Deltas"] = Deltas;
+	doc["Dropped"] = Dropped;
+
+	JsonObject total = doc.createNestedObject("Total");
+	total["Ties"] = Total.Ties;
+	total["Wins"] = Total.Wins;
+	total["Losses"] = Total.Losses;
+
+	JsonArray leaderboard = doc.createNestedArray("Leaderboard");
+
+	for (int i = 0; i < Count; ++i)
+	{
+		FixedString<15> address("local");
+		JsonObject entry = leaderboard.createNestedObject();
+
+		if (Entries[i].Address != 0)
+		{
+			formatAddress(address, IPAddress(Entries[i].Address));
+		}
+
+		entry["Rank"] = i + 1;
+		entry["Name"] = (const char*)Entries[i].Name;
+		entry["Address"] = address.buffer();
+		entry["Ties"] = Entries[i].Score.Ties;
+		entry["Wins"] = Entries[i].Score.Wins;
+		entry["Losses"] = Entries[i].Score.Losses;
+		entry["Age"] = FleetClass::now() - Entries[i].LastSeen;
+		entry["Stale"] = Entries[i].Stale;
+	}
+
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Prints the FleetInfoClass instance data on the Serial stream.
+/// </summary>
+void FleetInfoClass::print()
+{
+	Serial.println("Fleet Info:");
+	Serial.print("    Devices:   "); Serial.println(Count);
+	Serial.printf("    Total:     %u/%u/%u (ties/wins/losses)\n", Total.Ties, Total.Wins, Total.Losses);
+
+	for (int i = 0; i < Count; ++i)
+	{
+		Serial.printf("    %2d. %-15s %6u %6u %6u\n", i + 1, Entries[i].Name,
+			Entries[i].Score.Wins, Entries[i].Score.Ties, Entries[i].Score.Losses);
+	}
+}
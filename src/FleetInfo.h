@@ -0,0 +1,40 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="FleetInfo.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "Fleet.h"
+#include "FixedString.h"
+
+/// <summary>
+/// This class holds the fleet leaderboard (a snapshot of the local totals and the known peers).
+/// </summary>
+class FleetInfoClass
+{
+public:
+	static const int CAPACITY = JSON_OBJECT_SIZE(8) + JSON_OBJECT_SIZE(3) +	// The JSON document capacity
+		JSON_ARRAY_SIZE(FleetClass::MAX_PEERS + 1) +
+		(FleetClass::MAX_PEERS + 1) * (JSON_OBJECT_SIZE(8) + 16);
+
+	FleetInfoClass(FleetClass& fleet);		// Using a FleetClass instance to get the data
+
+	FleetPeer Entries[FleetClass::MAX_PEERS + 1];	// The entries (sorted by wins)
+	int Count;								// The number of entries
+	FleetScore Total;						// The fleet totals
+	uint32_t Sent;							// The number of datagrams sent
+	uint32_t BytesSent;						// The number of bytes sent
+	uint32_t Received;						// The number of datagrams received
+	uint32_t Deltas;						// The number of delta updates received
+	uint32_t Dropped;						// The number of invalid or outdated datagrams
+
+	String serialize();						// Return a string serialization (JSON)
+	void print();							// Prints all fields on the serial line
+};
@@ -0,0 +1,63 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="FleetUdp.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include "FleetUdp.h"
+
+/// <summary>
+///  Joins the multicast group.
+/// </summary>
+/// <param name="group">The multicast group (network byte order)</param>
+/// <param name="port">The UDP port</param>
+/// <returns>True if successful</returns>
+bool UdpFleetTransport::begin(uint32_t group, uint16_t port)
+{
+	this->group = IPAddress(group);
+	this->port = port;
+
+	return udp.beginMulticast(this->group, port) == 1;
+}
+
+/// <summary>
+///  Sends a datagram to the multicast group.
+/// </summary>
+/// <param name="data">The datagram</param>
+/// <param name="len">The datagram length</param>
+/// <returns>True if successful</returns>
+bool UdpFleetTransport::send(const uint8_t* data, size_t len)
+{
+	if (udp.beginMulticastPacket() != 1)
+	{
+		return false;
+	}
+
+	udp.write(data, len);
+	return udp.endPacket() == 1;
+}
+
+/// <summary>
+///  Receives a pending datagram (returns 0 if none).
+/// </summary>
+/// <param name="data">The datagram buffer</param>
+/// <param name="size">The buffer size</param>
+/// <param name="address">The sender address (network byte order)</param>
+/// <returns>The datagram length</returns>
+int UdpFleetTransport::receive(uint8_t* data, size_t size, uint32_t& address)
+{
+	int len = udp.parsePacket();
+
+	if (len <= 0)
+	{
+		return 0;
+	}
+
+	address = (uint32_t)udp.remoteIP();
+	len = udp.read(data, size);
+	udp.flush();
+
+	return (len > 0) ? len : 0;
+}
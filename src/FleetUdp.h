@@ -0,0 +1,30 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="FleetUdp.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+#include "Fleet.h"
+
+/// <summary>
+/// The UDP multicast transport of the fleet gossip (ESP32). Datagrams are polled by the main task.
+/// </summary>
+class UdpFleetTransport : public FleetTransport
+{
+private:
+	WiFiUDP udp;							// The UDP instance
+	IPAddress group;						// The multicast group
+	uint16_t port = 0;						// The UDP port
+
+public:
+	bool begin(uint32_t group, uint16_t port) override;
+	bool send(const uint8_t* data, size_t len) override;
+	int receive(uint8_t* data, size_t size, uint32_t& address) override;
+};
@@ -8,31 +8,29 @@
 // --------------------------------------------------------------------------------------------------------------------
 #pragma once
 
-#include <Preferences.h>
+#include "SettingsBase.h"
 
 /// <summary>
 /// This class holds the Knoblomat game result data.
 /// </summary>
-class GameSettingsClass
+class GameSettingsClass : public SettingsBaseClass<GameSettingsClass>
 {
-private:
-	const char* NAMESPACE = "Game";			// The namspace used in preferences
-	const char* KEY_TIES = "Ties";			// The preference key for the Ties field
-	const char* KEY_WINS = "Wins";			// The preference key for the Wins field
-	const char* KEY_LOSSES = "Losses";		// The preference key for the Losses field
-
-	Preferences preferences;				// The EPS32 preferences instance
-
 public:
-	GameSettingsClass() {}
+	static constexpr const char* NAMESPACE = "Game";	// The namspace used in preferences
+	static const uint8_t VERSION = 1;				// The blob schema version
+
+	GameSettingsClass();
 
 	int Ties;								// The total number of ties
 	int Wins;								// The total number of wins
 	int Losses;								// The total number of losses
 
-	bool deserialize(String settings);		// Read a JSON string and updates the fields.
-	String serialize();						// Return a string serialization (JSON)
-	void clear();							// Clears the persistent storage
-	void save();							// Save the fields to storage
-	void init();							// Initializes the fields from storage
+	// The field descriptors (JSON and preference keys, limits and defaults).
+	static constexpr FieldDescriptor<GameSettingsClass> FIELDS[] = {
+		numberField("Ties", &GameSettingsClass::Ties, 0, INT32_MAX, 0),
+		numberField("Wins", &GameSettingsClass::Wins, 0, INT32_MAX, 0),
+		numberField("Losses", &GameSettingsClass::Losses, 0, INT32_MAX, 0),
+	};
+
+	static constexpr int CAPACITY = fieldCapacity(FIELDS);	// The JSON document capacity
 };
@@ -0,0 +1,251 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Leaderboard.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+
+#include "Leaderboard.h"
+#include "SettingsBase.h"
+
+/// <summary>
+///  Compares two results: the higher win rate ranks first, then the higher number of games.
+///  The rates are compared by cross multiplication (no division, no floating point).
+/// </summary>
+/// <returns>True if a ranks before b</returns>
+bool LeaderboardClass::better(const LeaderboardEntry& a, const LeaderboardEntry& b)
+{
+	uint32_t gamesA = (uint32_t)a.Wins + a.Losses + a.Ties;
+	uint32_t gamesB = (uint32_t)b.Wins + b.Losses + b.Ties;
+	uint64_t rateA = (uint64_t)a.Wins * gamesB;
+	uint64_t rateB = (uint64_t)b.Wins * gamesA;
+
+	return (rateA != rateB) ? (rateA > rateB) : (gamesA > gamesB);
+}
+
+/// <summary>
+///  Returns the insert position of a result (binary search, after all entries ranking equal or better).
+/// </summary>
+int LeaderboardClass::position(const LeaderboardEntry& entry)
+{
+	int low = 0;
+	int high = count;
+
+	while (low < high)
+	{
+		int middle = (low + high) / 2;
+
+		if (better(entry, entries[middle]))
+		{
+			high = middle;
+		}
+		else
+		{
+			low = middle + 1;
+		}
+	}
+
+	return low;
+}
+
+/// <summary>
+///  Returns the index of a name (or -1).
+/// </summary>
+int LeaderboardClass::find(const char* name)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		if (strncmp(entries[i].Name, name, sizeof(entries[i].Name)) == 0)
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/// <summary>
+///  Inserts a result. A listed name is only replaced by a better result.
+/// </summary>
+/// <param name="entry">The result (the name is truncated to 15 characters)</param>
+/// <returns>The submission result</returns>
+LeaderboardClass::Result LeaderboardClass::submit(const LeaderboardEntry& entry)
+{
+	LeaderboardEntry result = entry;
+	result.Name[sizeof(result.Name) - 1] = '\0';
+
+	if (result.Name[0] == '\0')
+	{
+		return InvalidName;
+	}
+
+	if ((uint32_t)result.Wins + result.Losses + result.Ties < MIN_GAMES)
+	{
+		return TooFewGames;
+	}
+
+	int index = find(result.Name);
+
+	if ((index >= 0) && !better(result, entries[index]))
+	{
+		return NotRanked;
+	}
+
+	int pos = position(result);
+
+	if ((index < 0) && (pos >= SIZE))
+	{
+		return NotRanked;
+	}
+
+	lock.lock();
+
+	// Remove the previous result of the name (always ranked after the new position).
+	if (index >= 0)
+	{
+		memmove(&entries[index], &entries[index + 1], (count - index - 1) * sizeof(LeaderboardEntry));
+		--count;
+	}
+
+	int moved = ((count < SIZE) ? count : SIZE - 1) - pos;
+
+	if (moved > 0)
+	{
+		memmove(&entries[pos + 1], &entries[pos], moved * sizeof(LeaderboardEntry));
+	}
+
+	entries[pos] = result;
+
+	if (count < SIZE)
+	{
+		++count;
+	}
+
+	lock.unlock();
+
+	return Ranked;
+}
+
+/// <summary>
+///  Copies the entries (under the lock, any task).
+/// </summary>
+/// <param name="entries">The entry buffer (SIZE entries)</param>
+/// <returns>The number of entries</returns>
+int LeaderboardClass::read(LeaderboardEntry* entries)
+{
+	lock.lock();
+	int n = count;
+	memcpy(entries, this->entries, n * sizeof(LeaderboardEntry));
+	lock.unlock();
+
+	return n;
+}
+
+/// <summary>
+///  Initializes the entries from the non volatile storage (single blob read).
+/// </summary>
+void LeaderboardClass::init()
+{
+	Blob blob;
+
+	preferences.begin(NAMESPACE, false);
+	size_t length = preferences.getBytes(KEY_BLOB, &blob, sizeof(blob));
+	preferences.end();
+
+	uint32_t crc = blob.CRC;
+	blob.CRC = 0;
+
+	if ((length != sizeof(blob)) || (blob.Version != VERSION) || (blob.Count > SIZE) ||
+		(settingsCrc32((const uint8_t*)&blob, sizeof(blob)) != crc))
+	{
+		return;
+	}
+
+	lock.lock();
+	memcpy(entries, blob.Entries, sizeof(entries));
+	count = blob.Count;
+	lock.unlock();
+}
+
+/// <summary>
+///  Saves the entries to the non volatile storage (single blob write).
+/// </summary>
+void LeaderboardClass::save()
+{
+	Blob blob;
+
+	memset(&blob, 0, sizeof(blob));
+	blob.Version = VERSION;
+	blob.Count = (uint8_t)count;
+	memcpy(blob.Entries, entries, count * sizeof(LeaderboardEntry));
+	blob.CRC = settingsCrc32((const uint8_t*)&blob, sizeof(blob));
+
+	preferences.begin(NAMESPACE, false);
+	preferences.putBytes(KEY_BLOB, &blob, sizeof(blob));
+	preferences.end();
+}
+
+/// <summary>
+///  Clears the entries and the non volatile storage.
+/// </summary>
+void LeaderboardClass::clear()
+{
+	lock.lock();
+	count = 0;
+	lock.unlock();
+
+	preferences.begin(NAMESPACE, false);
+	preferences.remove(KEY_BLOB);
+	preferences.end();
+}
+
+/// <summary>
+///  Returns the name of a submission result.
+/// </summary>
+const char* LeaderboardClass::name(Result result)
+{
+	switch (result)
+	{
+	case Ranked: return "Ranked";
+	case NotRanked: return "NotRanked";
+	case TooFewGames: return "TooFewGames";
+	default: return "InvalidName";
+	}
+}
+
+/// <summary>
+///  Serialize the leaderboard to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String LeaderboardClass::serialize()
+{
+	LeaderboardEntry copy[SIZE];
+	int n = read(copy);
+	StaticJsonDocument<CAPACITY> doc;
+	String json;
+
+	doc["MinGames"] = (int)MIN_GAMES;
+	JsonArray list = doc.createNestedArray("Entries");
+
+	for (int i = 0; i < n; ++i)
+	{
+		uint32_t games = (uint32_t)copy[i].Wins + copy[i].Losses + copy[i].Ties;
+		JsonObject entry = list.createNestedObject();
+		entry["Rank"] = i + 1;
+		entry["Name"] = (const char*)copy[i].Name;
+		entry["Wins"] = copy[i].Wins;
+		entry["Losses"] = copy[i].Losses;
+		entry["Ties"] = copy[i].Ties;
+		entry["Games"] = games;
+		entry["Rate"] = (games > 0) ? (float)copy[i].Wins / games : 0.0f;
+	}
+
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
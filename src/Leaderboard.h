@@ -0,0 +1,82 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Leaderboard.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Preferences.h>
+#include <ArduinoJson.h>
+
+#include "SnapshotLock.h"
+
+/// <summary>
+/// A leaderboard entry (plain old data, stored as is in the NVS blob).
+/// </summary>
+struct LeaderboardEntry
+{
+	char Name[16];							// The player name
+	uint16_t Wins;							// The number of wins
+	uint16_t Losses;						// The number of losses
+	uint16_t Ties;							// The number of ties
+};
+
+/// <summary>
+/// This class keeps the top K players ranked by win rate (wins per game, at least MIN_GAMES games).
+/// Equal rates are ranked by the number of games. The entries are kept in a fixed size sorted array,
+/// the position of a new result is found by binary search. Each name is listed once (with its best result).
+/// The array is stored as a single blob (with CRC) in NVS. It is changed by the main task and copied
+/// under a short critical section (see SnapshotLock), nothing is allocated on the update path.
+/// </summary>
+class LeaderboardClass
+{
+public:
+	static const int SIZE = 10;				// The number of entries (K)
+	static const int MIN_GAMES = 5;			// The minimum number of games to be ranked
+	static const uint8_t VERSION = 1;		// The blob schema version
+	static const int CAPACITY = JSON_OBJECT_SIZE(2) + JSON_ARRAY_SIZE(SIZE) + SIZE * JSON_OBJECT_SIZE(7);
+
+	/// <summary>
+	/// The result of a submission.
+	/// </summary>
+	enum Result { Ranked, NotRanked, TooFewGames, InvalidName };
+
+private:
+	/// <summary>
+	/// The NVS blob (header and entries).
+	/// </summary>
+	struct Blob
+	{
+		uint32_t CRC;						// The CRC-32 (calculated with CRC = 0)
+		uint8_t Version;					// The schema version
+		uint8_t Count;						// The number of entries
+		uint16_t Reserved;					// Padding
+		LeaderboardEntry Entries[SIZE];		// The entries (best first)
+	};
+
+	const char* NAMESPACE = "Leaderboard";	// The namspace used in preferences
+	const char* KEY_BLOB = "Blob";			// The preference key for the blob
+
+	LeaderboardEntry entries[SIZE];			// The sorted entries (best first)
+	int count = 0;							// The number of entries
+	SnapshotLock lock;						// Guards the entries
+	Preferences preferences;				// The ESP32 preferences instance
+
+	static bool better(const LeaderboardEntry& a, const LeaderboardEntry& b);
+	int position(const LeaderboardEntry& entry);
+	int find(const char* name);
+
+public:
+	Result submit(const LeaderboardEntry& entry);	// Inserts a result (main task only)
+	int read(LeaderboardEntry* entries);		// Copies the entries (any task)
+
+	void clear();							// Clears the entries and the persistent storage
+	void save();							// Save the entries to storage
+	void init();							// Initializes the entries from storage
+
+	static const char* name(Result result);	// Returns the name of a result
+	String serialize();						// Return a string serialization (JSON)
+};
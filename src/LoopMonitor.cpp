@@ -0,0 +1,132 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="LoopMonitor.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+
+#include "LoopMonitor.h"
+
+// The upper bin limits: 50us, 100us, 500us, 1ms, 5ms, 10ms, 100ms (and above).
+const uint32_t LoopMonitorClass::BINS[BIN_COUNT - 1] = { 50, 100, 500, 1000, 5000, 10000, 100000 };
+
+// The probe names (see LoopProbe).
+const char* LoopMonitorClass::NAMES[PROBES] = { "Period", "Led", "Commands", "Smart", "Reconfigure", "Networks", "WiFi", "Reboot", "Health", "Benchmark", "Fleet", "Timer", "Diagnostics", "Admission" };
+
+/// <summary>
+///  Starts a loop iteration, the time since the previous start is the loop period.
+/// </summary>
+void LoopMonitorClass::begin()
+{
+	uint32_t now = micros();
+
+	if (last != 0)
+	{
+		record(LoopProbe::Period, now - last);
+	}
+
+	last = now;
+}
+
+/// <summary>
+///  Runs a check function and records its duration.
+/// </summary>
+/// <param name="probe">The loop probe</param>
+/// <param name="check">The check function</param>
+void LoopMonitorClass::measure(LoopProbe probe, void (*check)())
+{
+	uint32_t start = micros();
+
+	if (trace != NULL) *trace = (uint8_t)probe;
+	check();
+	if (trace != NULL) *trace = 0xFF;
+
+	record(probe, micros() - start);
+}
+
+/// <summary>
+///  Sets the cell the running probe is written to (0xFF between the check functions).
+///  A cell in RTC memory tells the check function running at a crash after the restart.
+/// </summary>
+/// <param name="cell">The probe cell (NULL to detach)</param>
+void LoopMonitorClass::attach(volatile uint8_t* cell)
+{
+	trace = cell;
+}
+
+/// <summary>
+///  Adds a time to the statistics of a probe.
+/// </summary>
+/// <param name="probe">The loop probe</param>
+/// <param name="time">The time (usec)</param>
+void LoopMonitorClass::record(LoopProbe probe, uint32_t time)
+{
+	volatile LoopStats& entry = stats[(int)probe];
+	int bin = 0;
+
+	while ((bin < BIN_COUNT - 1) && (time >= BINS[bin]))
+	{
+		++bin;
+	}
+
+	entry.Count = entry.Count + 1;
+	entry.Total = entry.Total + time;
+	entry.Bins[bin] = entry.Bins[bin] + 1;
+
+	if (time > entry.Max)
+	{
+		entry.Max = time;
+	}
+}
+
+/// <summary>
+///  Serialize the LoopMonitorClass instance data to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String LoopMonitorClass::serialize()
+{
+	const int capacity = JSON_OBJECT_SIZE(2) + JSON_ARRAY_SIZE(BIN_COUNT - 1) + JSON_OBJECT_SIZE(PROBES) +
+		PROBES * (JSON_OBJECT_SIZE(4) + JSON_ARRAY_SIZE(BIN_COUNT));
+	StaticJsonDocument<capacity> doc;
+	String json;
+
+	JsonArray limits = doc.createNestedArray("Bins");
+
+	for (int bin = 0; bin < BIN_COUNT - 1; ++bin)
+	{
+		limits.add(BINS[bin]);
+	}
+
+	JsonObject probes = doc.createNestedObject("Probes");
+
+	for (int i = 0; i < PROBES; ++i)
+	{
+		JsonObject probe = probes.createNestedObject(NAMES[i]);
+		uint32_t count = stats[i].Count;
+
+		probe["Count"] = count;
+		probe["Average"] = (count > 0) ? (uint32_t)(stats[i].Total / count) : 0;
+		probe["Max"] = (uint32_t)stats[i].Max;
+
+		JsonArray bins = probe.createNestedArray("Histogram");
+
+		for (int bin = 0; bin < BIN_COUNT; ++bin)
+		{
+			bins.add((uint32_t)stats[i].Bins[bin]);
+		}
+	}
+
+	if (doc.overflowed())
+	{
+		Serial.println("Loop statistics truncated (JSON capacity)");
+	}
+
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
@@ -0,0 +1,72 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="LoopMonitor.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Arduino.h>
+
+/// <summary>
+/// The measured parts of the main loop (Period is the time between two loop iterations).
+/// </summary>
+enum class LoopProbe : uint8_t
+{
+	Period,
+	Led,
+	Commands,
+	Smart,
+	Reconfigure,
+	Networks,
+	WiFi,
+	Reboot,
+	Health,
+	Benchmark,
+	Fleet,
+	Timer,
+	Diagnostics,
+	Admission,
+	Count
+};
+
+/// <summary>
+/// The timing statistics of a loop probe (times in usec).
+/// </summary>
+struct LoopStats
+{
+	uint32_t Count;							// The number of measurements
+	uint64_t Total;							// The total time (a read may be torn while the low word carries)
+	uint32_t Max;							// The maximum time
+	uint32_t Bins[8];						// The histogram (see LoopMonitorClass::BINS)
+};
+
+/// <summary>
+/// This class measures the period of the main loop and the duration of each check function.
+/// The times are counted in a fixed histogram per probe. The statistics are written by the main task
+/// and read by the handlers without locking (single writer, a snapshot may mix two iterations).
+/// </summary>
+class LoopMonitorClass
+{
+public:
+	static const int PROBES = (int)LoopProbe::Count;	// The number of probes
+	static const int BIN_COUNT = 8;						// The number of histogram bins
+	static const uint32_t BINS[BIN_COUNT - 1];			// The upper bin limits (usec), the last bin is open
+	static const char* NAMES[PROBES];					// The probe names
+
+private:
+	volatile LoopStats stats[PROBES] = {};				// The statistics per probe
+	uint32_t last = 0;									// The start of the previous iteration (usec)
+	volatile uint8_t* trace = NULL;						// The cell holding the running probe (optional)
+
+	void record(LoopProbe probe, uint32_t time);
+
+public:
+	void begin();										// Starts a loop iteration (records the period)
+	void measure(LoopProbe probe, void (*check)());		// Runs and measures a check function
+	void attach(volatile uint8_t* cell);				// Writes the running probe into a cell (e.g. RTC memory)
+
+	String serialize();									// Return a string serialization (JSON)
+};
@@ -0,0 +1,129 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="MemoryInfo.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+#include <ESP.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "MemoryInfo.h"
+
+// The monitored tasks: the Arduino loop, the async web server, the WiFi driver, the TCP/IP stack and the event loop
+// (the legacy event loop task of IDF 3.x, see esp_event_loop.c).
+const char* MemoryInfoClass::TASK_NAMES[] = { "loopTask", "async_tcp", "wifi", "tiT", "eventTask" };
+
+/// <summary>
+///  Reads the heap statistics for the specified capabilities.
+///  The fragmentation is the share of free memory not available in the largest free block.
+/// </summary>
+/// <param name="caps">The heap capabilities (MALLOC_CAP_xxx)</param>
+void HeapRegionInfo::read(uint32_t caps)
+{
+	multi_heap_info_t info;
+	heap_caps_get_info(&info, caps);
+
+	TotalFree = info.total_free_bytes;
+	TotalAllocated = info.total_allocated_bytes;
+	LargestFreeBlock = info.largest_free_block;
+	MinimumFree = info.minimum_free_bytes;
+	AllocatedBlocks = info.allocated_blocks;
+	FreeBlocks = info.free_blocks;
+	Fragmentation = (TotalFree > 0) ? 100 - (int)((100ULL * LargestFreeBlock) / TotalFree) : 0;
+}
+
+/// <summary>
+///  Using the global ESP instance and the heap capabilities API to get the actual data.
+/// </summary>
+MemoryInfoClass::MemoryInfoClass()
+{
+	FreeHeap = ESP.getFreeHeap();
+	MinFreeHeap = ESP.getMinFreeHeap();
+	MaxAllocHeap = ESP.getMaxAllocHeap();
+	Fragmentation = (FreeHeap > 0) ? 100 - (int)((100ULL * MaxAllocHeap) / FreeHeap) : 0;
+
+	Internal.read(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	PSRAM.read(MALLOC_CAP_SPIRAM);
+	DMA.read(MALLOC_CAP_DMA);
+
+	for (int i = 0; i < TASK_COUNT; i++)
+	{
+		TaskHandle_t handle = xTaskGetHandle(TASK_NAMES[i]);
+
+		Stacks[i].Name = TASK_NAMES[i];
+		Stacks[i].HighWaterMark = (handle != NULL) ? (int32_t)uxTaskGetStackHighWaterMark(handle) : -1;
+	}
+}
+
+/// <summary>
+///  Adds the heap region statistics to a JSON object.
+/// </summary>
+/// <param name="obj">The JSON object</param>
+/// <param name="region">The heap region info</param>
+static void serializeRegion(JsonObject obj, const HeapRegionInfo& region)
+{
+	obj["TotalFree"] = region.TotalFree;
+	obj["TotalAllocated"] = region.TotalAllocated;
+	obj["LargestFreeBlock"] = region.LargestFreeBlock;
+	obj["MinimumFree"] = region.MinimumFree;
+	obj["AllocatedBlocks"] = region.AllocatedBlocks;
+	obj["FreeBlocks"] = region.FreeBlocks;
+	obj["Fragmentation"] = region.Fragmentation;
+}
+
+/// <summary>
+///  Serialize the MemoryInfoClass instance to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String MemoryInfoClass::serialize()
+{
+	const int capacity = JSON_OBJECT_SIZE(8) + 3 * JSON_OBJECT_SIZE(7) + JSON_OBJECT_SIZE(TASK_COUNT);
+	StaticJsonDocument<capacity> doc;
+	String json;
+
+	doc["FreeHeap"] = FreeHeap;
+	doc["MinFreeHeap"] = MinFreeHeap;
+	doc["MaxAllocHeap"] = MaxAllocHeap;
+	doc["Fragmentation"] = Fragmentation;
+
+	serializeRegion(doc.createNestedObject("Internal"), Internal);
+	serializeRegion(doc.createNestedObject("PSRAM"), PSRAM);
+	serializeRegion(doc.createNestedObject("DMA"), DMA);
+
+	JsonObject stacks = doc.createNestedObject("Stacks");
+
+	for (int i = 0; i < TASK_COUNT; i++)
+	{
+		stacks[Stacks[i].Name] = Stacks[i].HighWaterMark;
+	}
+
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Prints the MemoryInfoClass instance data on the Serial stream.
+/// </summary>
+void MemoryInfoClass::print()
+{
+	Serial.println("Memory Info:");
+	Serial.print("    FreeHeap:         "); Serial.println(FreeHeap);
+	Serial.print("    MinFreeHeap:      "); Serial.println(MinFreeHeap);
+	Serial.print("    MaxAllocHeap:     "); Serial.println(MaxAllocHeap);
+	Serial.print("    Fragmentation(%): "); Serial.println(Fragmentation);
+	Serial.print("    Internal free:    "); Serial.println(Internal.TotalFree);
+	Serial.print("    PSRAM free:       "); Serial.println(PSRAM.TotalFree);
+	Serial.print("    DMA free:         "); Serial.println(DMA.TotalFree);
+
+	for (int i = 0; i < TASK_COUNT; i++)
+	{
+		Serial.printf("    Stack %-10s  %d\n", Stacks[i].Name, Stacks[i].HighWaterMark);
+	}
+}
@@ -0,0 +1,61 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="MemoryInfo.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+/// <summary>
+/// This structure holds the heap statistics for a single memory capability (see heap_caps_get_info).
+/// </summary>
+struct HeapRegionInfo
+{
+	uint32_t TotalFree;						// The total free bytes
+	uint32_t TotalAllocated;				// The total allocated bytes
+	uint32_t LargestFreeBlock;				// The largest free block in bytes
+	uint32_t MinimumFree;					// The minimum free bytes ever seen
+	uint32_t AllocatedBlocks;				// The number of allocated blocks
+	uint32_t FreeBlocks;					// The number of free blocks
+	int Fragmentation;						// The fragmentation in percent (0 = none)
+
+	void read(uint32_t caps);				// Reads the statistics for the given capabilities
+};
+
+/// <summary>
+/// This structure holds the stack high-water mark of a single FreeRTOS task.
+/// </summary>
+struct TaskStackInfo
+{
+	const char* Name;						// The FreeRTOS task name
+	int32_t HighWaterMark;					// The minimum free stack in bytes (-1 if not found)
+};
+
+/// <summary>
+/// This class holds the current heap fragmentation and task stack data.
+/// </summary>
+class MemoryInfoClass
+{
+public:
+	static const int TASK_COUNT = 5;		// The number of monitored tasks
+	static const char* TASK_NAMES[];		// The names of the monitored tasks
+
+	MemoryInfoClass();						// Initialize the memory info fields
+
+	uint32_t FreeHeap;						// The amount of free heap in bytes
+	uint32_t MinFreeHeap;					// The minimum free heap ever seen in bytes
+	uint32_t MaxAllocHeap;					// The largest allocatable heap block in bytes
+	int Fragmentation;						// The default heap fragmentation in percent
+	HeapRegionInfo Internal;				// The internal RAM statistics
+	HeapRegionInfo PSRAM;					// The external SPI RAM statistics
+	HeapRegionInfo DMA;						// The DMA capable RAM statistics
+	TaskStackInfo Stacks[TASK_COUNT];		// The task stack high-water marks
+
+	String serialize();						// Return a string serialization (JSON)
+	void print();							// Prints all fields on the serial line
+};
@@ -0,0 +1,236 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="OtaUpdate.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+#include <ESP.h>
+
+#include "OtaUpdate.h"
+
+/// <summary>
+///  Erases the partition ahead of a write, one sector at a time (erasing the whole partition
+///  at once blocks the calling task for seconds).
+/// </summary>
+/// <param name="partition">The partition</param>
+/// <param name="erased">The end of the erased range (updated)</param>
+/// <param name="end">The end of the next write</param>
+/// <returns>True if successful</returns>
+static bool eraseAhead(const esp_partition_t* partition, size_t& erased, size_t end)
+{
+	while (erased < end)
+	{
+		if (esp_partition_erase_range(partition, erased, SPI_FLASH_SEC_SIZE) != ESP_OK)
+		{
+			return false;
+		}
+
+		erased += SPI_FLASH_SEC_SIZE;
+	}
+
+	return true;
+}
+
+/// <summary>
+///  Finds the inactive app partition (the partition is erased while writing, see write()).
+/// </summary>
+bool OtaPartitionWriter::begin(size_t size)
+{
+	partition = esp_ota_get_next_update_partition(NULL);
+	offset = 0;
+	erased = 0;
+
+	return (partition != NULL) && (size <= partition->size);
+}
+
+/// <summary>
+///  Writes the next block to the app partition (the image has to start with the app image header).
+/// </summary>
+bool OtaPartitionWriter::write(const uint8_t* data, size_t len)
+{
+	if ((offset == 0) && (len > 0) && (data[0] != ESP_IMAGE_HEADER_MAGIC))
+	{
+		return false;
+	}
+
+	if ((offset + len > partition->size) || !eraseAhead(partition, erased, offset + len) ||
+		(esp_partition_write(partition, offset, data, len) != ESP_OK))
+	{
+		return false;
+	}
+
+	offset += len;
+	return true;
+}
+
+/// <summary>
+///  Selects the partition for the next boot (the app image is validated first).
+/// </summary>
+bool OtaPartitionWriter::end()
+{
+	return esp_ota_set_boot_partition(partition) == ESP_OK;
+}
+
+/// <summary>
+///  Nothing to discard (the boot partition is not changed).
+/// </summary>
+void OtaPartitionWriter::abort()
+{
+}
+
+/// <summary>
+///  Finds the SPIFFS partition (the partition is erased while writing, see write()).
+/// </summary>
+bool SpiffsPartitionWriter::begin(size_t size)
+{
+	partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, NULL);
+	offset = 0;
+	erased = 0;
+
+	return (partition != NULL) && (size <= partition->size);
+}
+
+/// <summary>
+///  Writes the next block to the SPIFFS partition.
+/// </summary>
+bool SpiffsPartitionWriter::write(const uint8_t* data, size_t len)
+{
+	if ((offset + len > partition->size) || !eraseAhead(partition, erased, offset + len) ||
+		(esp_partition_write(partition, offset, data, len) != ESP_OK))
+	{
+		return false;
+	}
+
+	offset += len;
+	return true;
+}
+
+/// <summary>
+///  Nothing to activate (the image is written in place).
+/// </summary>
+bool SpiffsPartitionWriter::end()
+{
+	return true;
+}
+
+/// <summary>
+///  Nothing to discard (the partition has to be rewritten).
+/// </summary>
+void SpiffsPartitionWriter::abort()
+{
+}
+
+/// <summary>
+///  Checks for a pending (unconfirmed) image. If it has been booted MAX_ATTEMPTS times
+///  without confirmation the previous app partition is selected and the chip is restarted.
+/// </summary>
+void OtaUpdateClass::boot()
+{
+	preferences.begin(NAMESPACE, false);
+	Pending = preferences.getBool(KEY_PENDING, false);
+	RolledBack = preferences.getBool(KEY_ROLLBACK, false);
+
+	if (Pending)
+	{
+		int attempts = preferences.getInt(KEY_ATTEMPTS, 0) + 1;
+		preferences.putInt(KEY_ATTEMPTS, attempts);
+
+		if (attempts > MAX_ATTEMPTS)
+		{
+			preferences.end();
+			rollback();
+			return;
+		}
+	}
+
+	preferences.end();
+}
+
+/// <summary>
+///  Selects the previous app partition and restarts the chip (the pending image has not been
+///  confirmed). If the previous partition cannot be selected the running image is kept.
+/// </summary>
+void OtaUpdateClass::rollback()
+{
+	preferences.begin(NAMESPACE, false);
+	String label = preferences.getString(KEY_PREVIOUS, "");
+	const esp_partition_t* previous = esp_partition_find_first(ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_ANY, label.c_str());
+
+	preferences.putBool(KEY_PENDING, false);
+	preferences.putBool(KEY_ROLLBACK, true);
+	preferences.end();
+
+	Pending = false;
+	RolledBack = true;
+
+	if ((previous != NULL) && (esp_ota_set_boot_partition(previous) == ESP_OK))
+	{
+		Serial.print("Firmware not confirmed - rolling back to "); Serial.println(label);
+		ESP.restart();
+	}
+}
+
+/// <summary>
+///  Marks the new image as pending, storing the running partition for a rollback.
+/// </summary>
+void OtaUpdateClass::pending()
+{
+	const esp_partition_t* running = esp_ota_get_running_partition();
+
+	preferences.begin(NAMESPACE, false);
+	preferences.putString(KEY_PREVIOUS, running->label);
+	preferences.putInt(KEY_ATTEMPTS, 0);
+	preferences.putBool(KEY_PENDING, true);
+	preferences.putBool(KEY_ROLLBACK, false);
+	preferences.end();
+}
+
+/// <summary>
+///  Confirms the running image (the health check has passed).
+/// </summary>
+void OtaUpdateClass::confirm()
+{
+	if (Pending)
+	{
+		Pending = false;
+
+		preferences.begin(NAMESPACE, false);
+		preferences.putBool(KEY_PENDING, false);
+		preferences.putInt(KEY_ATTEMPTS, 0);
+		preferences.end();
+
+		Serial.println("Firmware confirmed");
+	}
+}
+
+/// <summary>
+///  Serialize the update status to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String OtaUpdateClass::serialize()
+{
+	static const char* STATES[] = { "Idle", "Running", "Done", "Failed" };
+	const int capacity = JSON_OBJECT_SIZE(10);
+	StaticJsonDocument<capacity> doc;
+	String json;
+
+	doc["Status"] = STATES[Stream.Status];
+	doc["Error"] = Stream.Error;
+	doc["Size"] = Stream.Size;
+	doc["Received"] = Stream.Received;
+	doc["Written"] = Stream.Written;
+	doc["Duration"] = Stream.Duration;
+	doc["Throughput"] = Stream.throughput();
+	doc["Partition"] = (const char*)esp_ota_get_running_partition()->label;
+	doc["Pending"] = Pending;
+	doc["RolledBack"] = RolledBack;
+
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
@@ -0,0 +1,88 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="OtaUpdate.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Preferences.h>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#include <esp_image_format.h>
+#include <esp_spi_flash.h>
+
+#include "UpdateStream.h"
+
+/// <summary>
+/// Writes a firmware image into the inactive OTA app partition and selects it for the next boot.
+/// The partition is written directly (esp_ota_begin erases the whole partition up front).
+/// </summary>
+class OtaPartitionWriter : public PartitionWriter
+{
+private:
+	const esp_partition_t* partition = NULL;	// The inactive app partition
+	size_t offset = 0;							// The write offset
+	size_t erased = 0;							// The end of the erased range
+
+public:
+	bool begin(size_t size) override;
+	bool write(const uint8_t* data, size_t len) override;
+	bool end() override;
+	void abort() override;
+};
+
+/// <summary>
+/// Writes a file system image into the data partition used by SPIFFS and LittleFS (in place, unmounted).
+/// </summary>
+class SpiffsPartitionWriter : public PartitionWriter
+{
+private:
+	const esp_partition_t* partition = NULL;	// The SPIFFS data partition
+	size_t offset = 0;							// The write offset
+	size_t erased = 0;							// The end of the erased range
+
+public:
+	bool begin(size_t size) override;
+	bool write(const uint8_t* data, size_t len) override;
+	bool end() override;
+	void abort() override;
+};
+
+/// <summary>
+/// This class guards a new firmware image: after an OTA update the image is marked pending, and if it
+/// does not pass the health check (see confirm()) within MAX_ATTEMPTS boots, or within HEALTH_DEADLINE
+/// of a boot, the previous app partition is selected again and the chip is restarted (see rollback()).
+/// </summary>
+class OtaUpdateClass
+{
+private:
+	const char* NAMESPACE = "OTA";				// The namespace used in preferences
+	const char* KEY_PENDING = "Pending";		// The preference key for the pending flag
+	const char* KEY_ATTEMPTS = "Attempts";		// The preference key for the boot attempts
+	const char* KEY_PREVIOUS = "Previous";		// The preference key for the previous partition label
+	const char* KEY_ROLLBACK = "Rollback";		// The preference key for the rollback flag
+
+	Preferences preferences;					// The ESP32 preferences instance
+
+public:
+	static const int MAX_ATTEMPTS = 2;			// The number of unconfirmed boots before rollback
+	static const unsigned long HEALTH_DELAY = 30000;	// The uptime required for confirmation (msec)
+	static const unsigned long HEALTH_DEADLINE = 3 * HEALTH_DELAY;	// The uptime without confirmation before rollback (msec)
+
+	UpdateStreamClass Stream;					// The update stream
+	OtaPartitionWriter Firmware;				// The firmware writer
+	SpiffsPartitionWriter FileSystem;			// The file system writer
+
+	bool Pending = false;						// The running image is not yet confirmed
+	bool RolledBack = false;					// The last update has been rolled back
+
+	void boot();								// Checks a pending image (call early in setup)
+	void pending();								// Marks the new image pending (after a firmware update)
+	void confirm();								// Confirms the running image (health check passed)
+	void rollback();							// Restarts with the previous image (health check failed)
+
+	String serialize();							// Return a string serialization (JSON)
+};
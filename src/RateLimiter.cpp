@@ -0,0 +1,151 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="RateLimiter.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+
+#include "RateLimiter.h"
+
+/// <summary>
+///  Takes a token from the bucket of the client sending the request.
+///  If the request is throttled a 429 response (with Retry-After) has already been sent.
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <param name="budget">The request budget</param>
+/// <returns>True if the request should be handled</returns>
+bool RateLimiterClass::allow(AsyncWebServerRequest* request, RateBudget budget)
+{
+	unsigned long now = millis();
+	Client* client = find((uint32_t)request->client()->remoteIP(), now);
+	uint32_t wait;
+
+	if (budget == RateBudget::Cheap)
+	{
+		wait = take(client->Buckets[(int)budget], CHEAP_BURST, CHEAP_REFILL, now);
+		if (wait > 0) ++CheapLimited;
+	}
+	else
+	{
+		wait = take(client->Buckets[(int)budget], EXPENSIVE_BURST, EXPENSIVE_REFILL, now);
+		if (wait > 0) ++ExpensiveLimited;
+	}
+
+	if (wait > 0)
+	{
+		AsyncWebServerResponse* response = request->beginResponse(429, "text/html", "Knoblomat too many requests");
+		response->addHeader("Retry-After", String((wait + 999) / 1000));
+		request->send(response);
+		return false;
+	}
+
+	++Allowed;
+	return true;
+}
+
+/// <summary>
+///  Finds the client entry of an address. A new client gets a free entry or replaces the least
+///  recently seen client (with full buckets).
+/// </summary>
+/// <param name="address">The IPv4 address</param>
+/// <param name="now">The current time (msec)</param>
+/// <returns>The client entry</returns>
+RateLimiterClass::Client* RateLimiterClass::find(uint32_t address, unsigned long now)
+{
+	Client* oldest = &clients[0];
+
+	for (int i = 0; i < MAX_CLIENTS; ++i)
+	{
+		if (clients[i].Address == address)
+		{
+			clients[i].LastSeen = now;
+			return &clients[i];
+		}
+
+		if ((oldest->Address != 0) && ((clients[i].Address == 0) || (now - clients[i].LastSeen > now - oldest->LastSeen)))
+		{
+			oldest = &clients[i];
+		}
+	}
+
+	if (oldest->Address != 0)
+	{
+		++Evicted;
+	}
+	else
+	{
+		++Clients;
+	}
+
+	oldest->Address = address;
+	oldest->LastSeen = now;
+	oldest->Buckets[(int)RateBudget::Cheap] = { (uint32_t)CHEAP_BURST * CHEAP_REFILL, now };
+	oldest->Buckets[(int)RateBudget::Expensive] = { (uint32_t)EXPENSIVE_BURST * EXPENSIVE_REFILL, now };
+
+	return oldest;
+}
+
+/// <summary>
+///  Refills the bucket and takes a token.
+/// </summary>
+/// <param name="bucket">The token bucket</param>
+/// <param name="burst">The burst size (tokens)</param>
+/// <param name="refill">The refill interval (msec per token)</param>
+/// <param name="now">The current time (msec)</param>
+/// <returns>The time until a token is available (0 if a token has been taken)</returns>
+uint32_t RateLimiterClass::take(Bucket& bucket, int burst, int refill, unsigned long now)
+{
+	uint32_t capacity = (uint32_t)burst * refill;
+	uint32_t elapsed = now - bucket.Time;
+
+	bucket.Tokens = (elapsed >= capacity - bucket.Tokens) ? capacity : bucket.Tokens + elapsed;
+	bucket.Time = now;
+
+	if (bucket.Tokens < (uint32_t)refill)
+	{
+		return refill - bucket.Tokens;
+	}
+
+	bucket.Tokens -= refill;
+	return 0;
+}
+
+/// <summary>
+///  Serializes the RateLimiterClass instance data to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String RateLimiterClass::serialize()
+{
+	const int capacity = JSON_OBJECT_SIZE(6);
+	StaticJsonDocument<capacity> doc;
+	String json;
+
+	doc["Clients"] = Clients;
+	doc["Size"] = (int)MAX_CLIENTS;
+	doc["Allowed"] = Allowed;
+	doc["CheapLimited"] = CheapLimited;
+	doc["ExpensiveLimited"] = ExpensiveLimited;
+	doc["Evicted"] = Evicted;
+
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Prints the RateLimiterClass instance data on the Serial stream.
+/// </summary>
+void RateLimiterClass::print()
+{
+	Serial.println("Rate Limiter:");
+	Serial.print("    Clients:          "); Serial.print(Clients); Serial.print(" / "); Serial.println((int)MAX_CLIENTS);
+	Serial.print("    Allowed:          "); Serial.println(Allowed);
+	Serial.print("    CheapLimited:     "); Serial.println(CheapLimited);
+	Serial.print("    ExpensiveLimited: "); Serial.println(ExpensiveLimited);
+	Serial.print("    Evicted:          "); Serial.println(Evicted);
+}
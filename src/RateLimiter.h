@@ -0,0 +1,74 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="RateLimiter.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <ESPAsyncWebServer.h>
+
+/// <summary>
+/// The request budgets of the mutating endpoints.
+/// </summary>
+enum class RateBudget : uint8_t
+{
+	Cheap,										// Requests without side effects on the flash (e.g. /reset, /led)
+	Expensive									// Requests writing the NVS or restarting (e.g. /ap, /reboot)
+};
+
+/// <summary>
+/// This class limits the rate of mutating requests per client (IPv4 address) using token buckets.
+/// Every client has a bucket per budget, a request takes one token, the tokens are refilled at a fixed
+/// rate up to the burst size. The clients are kept in a fixed size table, if it is full the least
+/// recently seen client is replaced. Throttled requests get a 429 (Too Many Requests).
+/// Note that all methods are called from the async_tcp task only (handlers).
+/// </summary>
+class RateLimiterClass
+{
+public:
+	static const int MAX_CLIENTS = 8;			// The size of the client table
+	static const int CHEAP_BURST = 10;			// The burst size of the cheap budget (requests)
+	static const int CHEAP_REFILL = 200;		// The refill interval of the cheap budget (msec per request)
+	static const int EXPENSIVE_BURST = 3;		// The burst size of the expensive budget (requests)
+	static const int EXPENSIVE_REFILL = 20000;	// The refill interval of the expensive budget (msec per request)
+
+private:
+	/// <summary>
+	/// A token bucket (the tokens are kept in msec of refill time).
+	/// </summary>
+	struct Bucket
+	{
+		uint32_t Tokens;						// The available tokens (msec)
+		unsigned long Time;						// The time of the last refill (msec)
+	};
+
+	/// <summary>
+	/// An entry of the client table.
+	/// </summary>
+	struct Client
+	{
+		uint32_t Address;						// The IPv4 address (0 if unused)
+		unsigned long LastSeen;					// The time of the last request (msec)
+		Bucket Buckets[2];						// The buckets (indexed by RateBudget)
+	};
+
+	Client clients[MAX_CLIENTS] = {};			// The client table
+
+	Client* find(uint32_t address, unsigned long now);
+	static uint32_t take(Bucket& bucket, int burst, int refill, unsigned long now);
+
+public:
+	int Clients = 0;							// The number of clients in the table
+	uint32_t Allowed = 0;						// The total number of allowed requests
+	uint32_t CheapLimited = 0;					// The total number of throttled cheap requests
+	uint32_t ExpensiveLimited = 0;				// The total number of throttled expensive requests
+	uint32_t Evicted = 0;						// The total number of replaced clients
+
+	bool allow(AsyncWebServerRequest* request, RateBudget budget);
+
+	String serialize();							// Return a string serialization (JSON)
+	void print();								// Prints all fields on the serial line
+};
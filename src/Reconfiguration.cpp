@@ -0,0 +1,121 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Reconfiguration.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+
+#include "Reconfiguration.h"
+
+/// <summary>
+///  Records the start of a reconfiguration. Unchanged settings are finished immediately.
+/// </summary>
+/// <param name="result">The interface result (Ap or WiFi)</param>
+/// <param name="path">The path taken</param>
+/// <param name="changed">The bit mask of the changed fields</param>
+void ReconfigurationClass::start(ReconfigureResult& result, ReconfigureResult::Path path, uint32_t changed)
+{
+	lock.lock();
+	result.Applied = path;
+	result.Changed = changed;
+	result.Started = millis();
+	result.Downtime = 0;
+	result.Success = (path == ReconfigureResult::Unchanged);
+	result.Pending = !result.Success;
+	++result.Count;
+	lock.unlock();
+}
+
+/// <summary>
+///  Records the end of a reconfiguration and the downtime.
+/// </summary>
+/// <param name="result">The interface result (Ap or WiFi)</param>
+/// <param name="success">True if the interface is up with the new settings</param>
+void ReconfigurationClass::finish(ReconfigureResult& result, bool success)
+{
+	lock.lock();
+	result.Downtime = millis() - result.Started;
+	result.Success = success;
+	result.Pending = false;
+	lock.unlock();
+}
+
+/// <summary>
+///  Records that the settings are applied by restarting the chip (the interface did not come up).
+/// </summary>
+/// <param name="result">The interface result (Ap or WiFi)</param>
+void ReconfigurationClass::reboot(ReconfigureResult& result)
+{
+	lock.lock();
+	result.Applied = ReconfigureResult::Reboot;
+	lock.unlock();
+}
+
+/// <summary>
+///  Checks the connect timeout of a pending reconfiguration.
+/// </summary>
+/// <param name="result">The interface result (Ap or WiFi)</param>
+/// <returns>True if the interface did not come up in time</returns>
+bool ReconfigurationClass::expired(const ReconfigureResult& result)
+{
+	return result.Pending && (millis() - result.Started > CONNECT_TIMEOUT);
+}
+
+/// <summary>
+///  Returns the name of a reconfiguration path.
+/// </summary>
+/// <param name="path">The path</param>
+/// <returns>The path name</returns>
+const char* ReconfigurationClass::name(ReconfigureResult::Path path)
+{
+	switch (path)
+	{
+	case ReconfigureResult::Unchanged: return "Unchanged";
+	case ReconfigureResult::Live: return "Live";
+	case ReconfigureResult::Reboot: return "Reboot";
+	default: return "None";
+	}
+}
+
+/// <summary>
+///  Adds a reconfiguration result to a JSON object.
+/// </summary>
+/// <param name="obj">The JSON object</param>
+/// <param name="result">The interface result</param>
+static void serializeResult(JsonObject obj, const ReconfigureResult& result)
+{
+	obj["Path"] = ReconfigurationClass::name(result.Applied);
+	obj["Changed"] = result.Changed;
+	obj["Pending"] = result.Pending;
+	obj["Success"] = result.Success;
+	obj["Downtime"] = result.Downtime;
+	obj["Age"] = (result.Applied != ReconfigureResult::None) ? (millis() - result.Started) / 1000 : 0;
+	obj["Count"] = result.Count;
+}
+
+/// <summary>
+///  Serialize the ReconfigurationClass instance data to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String ReconfigurationClass::serialize()
+{
+	const int capacity = JSON_OBJECT_SIZE(2) + 2 * JSON_OBJECT_SIZE(7);
+	StaticJsonDocument<capacity> doc;
+	String json;
+
+	lock.lock();
+	ReconfigureResult ap = Ap;
+	ReconfigureResult wifi = WiFi;
+	lock.unlock();
+
+	serializeResult(doc.createNestedObject("Ap"), ap);
+	serializeResult(doc.createNestedObject("WiFi"), wifi);
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
@@ -0,0 +1,70 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Reconfiguration.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Arduino.h>
+
+#include "WiFiSelector.h"
+#include "SnapshotLock.h"
+
+/// <summary>
+/// The result of applying new settings to a network interface (access point or WiFi station).
+/// </summary>
+struct ReconfigureResult
+{
+	/// <summary>
+	/// The way the settings have been applied.
+	/// </summary>
+	enum Path
+	{
+		None,									// No settings applied yet
+		Unchanged,								// The settings equal the running configuration
+		Live,									// Applied in place (the other interface stays up)
+		Reboot									// Applied by restarting the chip
+	};
+
+	Path Applied = None;						// The path taken
+	uint32_t Changed = 0;						// The bit mask of the changed fields (see SettingsBaseClass::changed)
+	bool Pending = false;						// The interface is coming up
+	bool Success = false;						// The interface is up with the new settings
+	unsigned long Started = 0;					// The time the settings have been applied (msec)
+	unsigned long Downtime = 0;					// The time the interface has been down (msec)
+	uint32_t Count = 0;							// The number of settings applied
+};
+
+/// <summary>
+/// This class tracks the live reconfiguration of the access point and the WiFi station.
+/// The new settings are diffed against the running configuration and applied in place, the chip is
+/// only restarted if the interface cannot be brought up again. The downtime is the time from taking
+/// the interface down until it is up again (or the connect timeout, the worst case of the network selection:
+/// the scan and an attempt for every candidate).
+/// The results are written by the main task under a lock and copied by the handlers (see /reconfigure).
+/// </summary>
+class ReconfigurationClass
+{
+public:
+	static const unsigned long CONNECT_TIMEOUT = WiFiSelectorClass::SCAN_TIMEOUT +
+		WiFiSelectorClass::SIZE * WiFiSelectorClass::CONNECT_TIMEOUT;	// The maximum time connecting to the network (msec)
+
+private:
+	SnapshotLock lock;							// Guards the results read by the handlers
+
+public:
+	ReconfigureResult Ap;						// The last access point reconfiguration
+	ReconfigureResult WiFi;						// The last WiFi station reconfiguration
+
+	void start(ReconfigureResult& result, ReconfigureResult::Path path, uint32_t changed);	// Takes the interface down
+	void finish(ReconfigureResult& result, bool success);	// The interface is up (or failed)
+	void reboot(ReconfigureResult& result);		// The settings are applied by restarting the chip
+	bool expired(const ReconfigureResult& result);	// The connect timeout has expired
+
+	static const char* name(ReconfigureResult::Path path);	// Returns the name of the path
+
+	String serialize();							// Return a string serialization (JSON)
+};
@@ -0,0 +1,79 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Rules.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <stdint.h>
+
+/// <summary>
+/// The hands (the values used by the game page: 1 = rock, 2 = scissors, 3 = paper).
+/// </summary>
+enum class Hand : uint8_t
+{
+	Rock = 1,
+	Scissors = 2,
+	Paper = 3
+};
+
+/// <summary>
+/// The outcome of a round seen from the player (the result values used by the game page).
+/// </summary>
+enum class Outcome : int8_t
+{
+	Loss = -1,
+	Tie = 0,
+	Win = 1
+};
+
+/// <summary>
+/// The rock-paper-scissors rules (platform independent, used by the firmware and the host tools).
+/// </summary>
+class RulesClass
+{
+public:
+	static const int HANDS = 3;											// The number of hands
+
+	/// <summary>
+	/// Returns the outcome for the player: rock beats scissors, scissors beat paper, paper beats rock.
+	/// </summary>
+	static Outcome play(Hand player, Hand machine)
+	{
+		// The outcome table indexed by [machine - 1][player - 1] (see results() in data/index.html).
+		static const int8_t OUTCOMES[HANDS][HANDS] = {
+			{  0, -1,  1 },
+			{  1,  0, -1 },
+			{ -1,  1,  0 }
+		};
+
+		return (Outcome)OUTCOMES[(int)machine - 1][(int)player - 1];
+	}
+
+	/// <summary>
+	/// Returns the hand beating the given hand.
+	/// </summary>
+	static Hand beat(Hand hand)
+	{
+		return (hand == Hand::Rock) ? Hand::Paper : (hand == Hand::Scissors) ? Hand::Rock : Hand::Scissors;
+	}
+
+	/// <summary>
+	/// Returns the hand for an index (0 ... HANDS - 1).
+	/// </summary>
+	static Hand hand(int index)
+	{
+		return (Hand)(index + 1);
+	}
+
+	/// <summary>
+	/// Returns the name of a hand.
+	/// </summary>
+	static const char* name(Hand hand)
+	{
+		return (hand == Hand::Rock) ? "rock" : (hand == Hand::Scissors) ? "scissors" : "paper";
+	}
+};
@@ -22,10 +22,10 @@ int ServerInfoClass::PORT = 80;						// The default web server port (80)
 ServerInfoClass::ServerInfoClass(WiFiClass wifi)
 {
 	Port = PORT;
-	Name = String(HOSTNAME);
-	WiFiAddress = wifi.localIP().toString();
-	ApAddress = wifi.softAPIP().toString();
-	Url = String("http://") + HOSTNAME;
+	Name = HOSTNAME;
+	formatAddress(WiFiAddress, wifi.localIP());
+	formatAddress(ApAddress, wifi.softAPIP());
+	Url.format("http://%s", HOSTNAME);
 }
 
 /// <summary>
@@ -34,31 +34,38 @@ ServerInfoClass::ServerInfoClass(WiFiClass wifi)
 /// <returns>The JSON string</returns>
 String ServerInfoClass::serialize()
 {
-	const int capacity = JSON_OBJECT_SIZE(4) + 100;
-	StaticJsonDocument<capacity> doc;
+	StaticJsonDocument<CAPACITY> doc;
 	String json;
 
-	doc["WiFiAddress"] = WiFiAddress;
-	doc["ApAddress"] = ApAddress;
-	doc["Name"] = Name;
-	doc["Port"] = Port;
-	doc["Url"] = Url;
-
+	serialize(doc.to<JsonObject>());
 	serializeJsonPretty(doc, json);
 
 	return json;
 }
 
+/// <summary>
+///  Add the data fields to a JSON object.
+/// </summary>
+/// <param name="doc">The JSON object</param>
+void ServerInfoClass::serialize(JsonObject doc)
+{
+	doc["WiFiAddress"] = WiFiAddress.c_str();
+	doc["ApAddress"] = ApAddress.c_str();
+	doc["Name"] = Name.c_str();
+	doc["Port"] = Port;
+	doc["Url"] = Url.c_str();
+}
+
 /// <summary>
 ///  Prints the ServerInfoClass instance data on the Serial stream.
 /// </summary>
 void ServerInfoClass::print()
 {
 	Serial.println("Web Server Info:");
-	Serial.print("    WiFi Address: "); Serial.println(WiFiAddress);
-	Serial.print("    AP Address:   "); Serial.println(ApAddress);
-	Serial.print("    Name:         "); Serial.println(Name);
+	Serial.print("    WiFi Address: "); Serial.println(WiFiAddress.c_str());
+	Serial.print("    AP Address:   "); Serial.println(ApAddress.c_str());
+	Serial.print("    Name:         "); Serial.println(Name.c_str());
 	Serial.print("    Port:         "); Serial.println(Port);
-	Serial.print("    URL:          "); Serial.println(Url);
+	Serial.print("    URL:          "); Serial.println(Url.c_str());
 }
 
@@ -9,6 +9,9 @@
 #pragma once
 
 #include <WiFi.h>
+#include <ArduinoJson.h>
+
+#include "FixedString.h"
 
 /// <summary>
 /// This class holds the actual HTTP server settings data.
@@ -18,15 +21,17 @@ class ServerInfoClass
 public:
 	static char* HOSTNAME;					// The default hostname (mDNS)
 	static int PORT;						// The default web server port (80)
+	static const int CAPACITY = JSON_OBJECT_SIZE(5) + 100;	// The JSON document capacity
 
 	ServerInfoClass(WiFiClass wifi);
 
-	String WiFiAddress;						// The web server IP address on the WiFi
-	String ApAddress;						// The web server IP address on the accesspoint
-	String Name;							// The web server hostname
+	FixedString<15> WiFiAddress;			// The web server IP address on the WiFi
+	FixedString<15> ApAddress;				// The web server IP address on the accesspoint
+	FixedString<32> Name;					// The web server hostname
 	int Port;								// The web server IP port
-	String Url;								// The web server URL (mDNS)
+	FixedString<40> Url;					// The web server URL (mDNS)
 
 	String serialize();						// Return a string serialization (JSON)
+	void serialize(JsonObject doc);			// Add the fields to a JSON object
 	void print();							// Prints all fields on the serial line
 };
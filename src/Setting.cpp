@@ -51,11 +51,7 @@ bool SettingsClass::deserialize(String json)
 {
 	if (json.length() > 0)
 	{
-		const int capacity = 2 * JSON_OBJECT_SIZE(3) +
-								 JSON_OBJECT_SIZE(7) +
-								 JSON_OBJECT_SIZE(9) + 550;
-		String json;
-		StaticJsonDocument<capacity> doc;
+		StaticJsonDocument<CAPACITY> doc;
 		DeserializationError err = deserializeJson(doc, json);
 
 		if (err)
@@ -63,15 +59,14 @@ bool SettingsClass::deserialize(String json)
 			return false;
 		}
 
-		serializeJson(doc["ApSettings"], json);
-		ApSettings.deserialize(json);
-		serializeJson(doc["WiFiSettings"], json);
-		WiFiSettings.deserialize(json);
-		serializeJson(doc["GameSettings"], json);
-		GameSettings.deserialize(json);
+		ApSettings.deserialize(doc["ApSettings"].as<JsonObject>());
+		WiFiSettings.deserialize(doc["WiFiSettings"].as<JsonObject>());
+		GameSettings.deserialize(doc["GameSettings"].as<JsonObject>());
 
 		return true;
 	}
+
+	return false;
 }
 
 /// <summary>
@@ -80,16 +75,39 @@ bool SettingsClass::deserialize(String json)
 /// <returns>The JSON string</returns>
 String SettingsClass::serialize()
 {
-	const int capacity = 2 * JSON_OBJECT_SIZE(3) +
-							 JSON_OBJECT_SIZE(7) +
-							 JSON_OBJECT_SIZE(9) + 550;
-	StaticJsonDocument<capacity> doc;
+	StaticJsonDocument<CAPACITY> doc;
 	String json;
 
-	doc["ApSettings"] = serialized(ApSettings.serialize());
-	doc["WiFiSettings"] = serialized(WiFiSettings.serialize());
-	doc["GameSettings"] = serialized(GameSettings.serialize());
+	serialize(doc.to<JsonObject>());
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
 
+/// <summary>
+///  Add the data fields to a JSON object (nested objects).
+/// </summary>
+/// <param name="doc">The JSON object</param>
+void SettingsClass::serialize(JsonObject doc)
+{
+	ApSettings.serialize(doc.createNestedObject("ApSettings"));
+	WiFiSettings.serialize(doc.createNestedObject("WiFiSettings"));
+	GameSettings.serialize(doc.createNestedObject("GameSettings"));
+}
+
+/// <summary>
+///  Serialize the storage statistics (blob source, size, load time, writes per save) to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String SettingsClass::serializeStorage()
+{
+	StaticJsonDocument<STORAGE_CAPACITY> doc;
+	String json;
+
+	ApSettings.serializeStorage(doc.createNestedObject("ApSettings"));
+	WiFiSettings.serializeStorage(doc.createNestedObject("WiFiSettings"));
+	GameSettings.serializeStorage(doc.createNestedObject("GameSettings"));
 	serializeJsonPretty(doc, json);
+
 	return json;
 }
@@ -18,12 +18,25 @@
 class SettingsClass
 {
 public:
+	static const int CAPACITY = JSON_OBJECT_SIZE(3) +			// The JSON document capacity
+								sizeof("ApSettings") +
+								sizeof("WiFiSettings") +
+								sizeof("GameSettings") +
+								ApSettingsClass::CAPACITY +
+								WiFiSettingsClass::CAPACITY +
+								GameSettingsClass::CAPACITY;
+
+	static const int STORAGE_CAPACITY = JSON_OBJECT_SIZE(3) +	// The storage statistics capacity
+										3 * JSON_OBJECT_SIZE(8);
+
 	ApSettingsClass ApSettings;				// The Access Point settings 
 	WiFiSettingsClass WiFiSettings;			// The WiFi connection settings
 	GameSettingsClass GameSettings;			// The Knoblomat game settings (score)
 
 	bool deserialize(String settings);		// Read a JSON string and updates the fields.
 	String serialize();						// Return a string serialization (JSON)
+	void serialize(JsonObject doc);			// Add the fields to a JSON object
+	String serializeStorage();				// Return the storage statistics (JSON)
 	void clear();							// Clears the persistent storage
 	void save();							// Save the fields to storage
 	void init();							// Initializes the fields from storage
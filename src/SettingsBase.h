@@ -0,0 +1,682 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="SettingsBase.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Preferences.h>
+#include <ArduinoJson.h>
+
+#include "FixedString.h"
+
+/// <summary>
+/// The type of a settings field.
+/// </summary>
+enum class FieldType { Text, Flag, Number };
+
+/// <summary>
+/// This structure describes a single settings field: the name (JSON and preference key), the type,
+/// the member, the maximum length (text) or range (number), the default value and the blob schema
+/// version introducing the field (new fields are appended, see SettingsBaseClass::unpack).
+/// The text members (FixedString) are reached by an accessor, as their type depends on the length.
+/// The descriptors are constant expressions, so the JSON capacity can be computed at compile time.
+/// </summary>
+template <typename T>
+struct FieldDescriptor
+{
+	FieldType Type;							// The field type
+	const char* Name;						// The JSON and preference key
+	char* (*TextMember)(T& settings);		// Returns the text member buffer (MaxLength + 1 bytes)
+	bool T::* FlagMember;					// The flag member
+	int T::* NumberMember;					// The number member
+	size_t MaxLength;						// The maximum text length
+	int Minimum;							// The minimum number
+	int Maximum;							// The maximum number
+	const char* TextDefault;				// The default text
+	int Default;							// The default flag or number
+	uint8_t Since;							// The blob schema version introducing the field
+};
+
+/// <summary>
+///  Returns the buffer of a text member (see textField).
+/// </summary>
+template <typename T, size_t N, FixedString<N> T::* M>
+char* fieldText(T& settings)
+{
+	return (settings.*M).buffer();
+}
+
+/// <summary>
+///  Describes a text field of N characters (truncated to the maximum length), e.g.
+///      textField&lt;WiFiSettingsClass, MAX_SSID_LEN, &amp;WiFiSettingsClass::SSID&gt;("SSID", "")
+/// </summary>
+template <typename T, size_t N, FixedString<N> T::* M>
+constexpr FieldDescriptor<T> textField(const char* name, const char* value, uint8_t since = 1)
+{
+	return { FieldType::Text, name, &fieldText<T, N, M>, nullptr, nullptr, N, 0, 0, value, 0, since };
+}
+
+/// <summary>
+///  Describes a flag field.
+/// </summary>
+template <typename T>
+constexpr FieldDescriptor<T> flagField(const char* name, bool T::* member, bool value, uint8_t since = 1)
+{
+	return { FieldType::Flag, name, nullptr, member, nullptr, 0, 0, 0, nullptr, value, since };
+}
+
+/// <summary>
+///  Describes a number field (clamped to the range).
+/// </summary>
+template <typename T>
+constexpr FieldDescriptor<T> numberField(const char* name, int T::* member, int minimum, int maximum, int value, uint8_t since = 1)
+{
+	return { FieldType::Number, name, nullptr, nullptr, member, 0, minimum, maximum, nullptr, value, since };
+}
+
+/// <summary>
+///  Returns the length of a string (compile time).
+/// </summary>
+constexpr size_t fieldNameLength(const char* name)
+{
+	return (*name != '\0') ? 1 + fieldNameLength(name + 1) : 0;
+}
+
+/// <summary>
+///  Returns the string storage needed by the fields (copied keys and texts of maximum length).
+/// </summary>
+template <typename T, size_t N>
+constexpr size_t fieldStringSize(const FieldDescriptor<T>(&fields)[N], size_t i = 0)
+{
+	return (i == N) ? 0 :
+		fieldNameLength(fields[i].Name) + 1 +
+		((fields[i].Type == FieldType::Text) ? fields[i].MaxLength + 1 : 0) +
+		fieldStringSize(fields, i + 1);
+}
+
+/// <summary>
+///  Returns the exact JSON document capacity for the fields (compile time).
+/// </summary>
+template <typename T, size_t N>
+constexpr size_t fieldCapacity(const FieldDescriptor<T>(&fields)[N])
+{
+	return JSON_OBJECT_SIZE(N) + fieldStringSize(fields);
+}
+
+/// <summary>
+///  Returns the packed blob size of the fields (texts with a length byte, numbers as int32).
+/// </summary>
+template <typename T, size_t N>
+constexpr size_t fieldBlobSize(const FieldDescriptor<T>(&fields)[N], size_t i = 0)
+{
+	return (i == N) ? 0 :
+		((fields[i].Type == FieldType::Text) ? 1 + fields[i].MaxLength :
+		 (fields[i].Type == FieldType::Flag) ? 1 : sizeof(int32_t)) +
+		fieldBlobSize(fields, i + 1);
+}
+
+/// <summary>
+///  Calculates the CRC-32 (IEEE 802.3) of a buffer.
+/// </summary>
+inline uint32_t settingsCrc32(const uint8_t* data, size_t length)
+{
+	uint32_t crc = 0xFFFFFFFF;
+
+	while (length--)
+	{
+		crc ^= *data++;
+
+		for (int i = 0; i < 8; ++i)
+		{
+			crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+		}
+	}
+
+	return ~crc;
+}
+
+/// <summary>
+/// The header of a settings blob (the CRC is calculated with the CRC field set to zero).
+/// </summary>
+struct SettingsBlobHeader
+{
+	uint32_t CRC;							// The CRC-32 of header and payload
+	uint16_t Length;						// The payload length
+	uint8_t Version;						// The schema version
+	uint8_t Count;							// The number of fields
+};
+
+/// <summary>
+/// This class implements the persistence and the JSON serialization of a settings class.
+/// Each settings class is stored as a single versioned blob (with CRC) in its preferences namespace.
+/// A new schema version appends fields (declared with the version as the last descriptor argument),
+/// a blob of an older version is upgraded keeping the stored fields.
+/// The settings class (T) derives from it and declares its fields once:
+///     static constexpr const char* NAMESPACE;				// The preferences namespace
+///     static const uint8_t VERSION;						// The blob schema version
+///     static constexpr FieldDescriptor&lt;T&gt; FIELDS[];	// The field descriptors
+///     static constexpr int CAPACITY;						// The JSON capacity (see fieldCapacity)
+/// </summary>
+template <typename T>
+class SettingsBaseClass
+{
+private:
+	static constexpr const char* BLOB_KEY = "Blob";	// The preference key for the blob
+
+	Preferences preferences;				// The ESP32 preferences instance
+
+	T& self() { return static_cast<T&>(*this); }
+
+	static void setText(char* buffer, size_t maxLength, const char* value, size_t length);	// Copies a text (truncated)
+
+	static constexpr size_t blobSize();		// Returns the maximum blob size
+	size_t pack(uint8_t* buffer);			// Packs the fields into a blob
+	bool unpack(uint8_t* buffer, size_t length, uint8_t& version);	// Unpacks the fields from a blob (current or older schema)
+
+public:
+	const char* Source = "Defaults";		// The source of the last load (Blob, Upgraded, Legacy, Invalid)
+	uint32_t LoadTime = 0;					// The duration of the last load (microseconds)
+	uint32_t LegacyTime = 0;				// The duration of the legacy key read (microseconds)
+	size_t Size = 0;						// The blob size (bytes)
+	uint8_t Writes = 0;						// The number of NVS writes of the last save
+	uint32_t Saves = 0;						// The number of saves since boot
+
+	void defaults();						// Sets all fields to the default values
+	void init();							// Initializes the fields from storage
+	void save();							// Save the fields to storage
+	void clear();							// Clears the persistent storage
+
+	bool deserialize(String json);			// Read a JSON string and updates the fields.
+	bool deserialize(JsonObject doc);		// Read a JSON object and updates the fields.
+	String serialize();						// Return a string serialization (JSON)
+	void serialize(JsonObject doc);			// Add the fields to a JSON object
+	void serializeStorage(JsonObject doc);	// Add the storage statistics to a JSON object
+
+	uint32_t changed(const T& other);		// Returns the bit mask of the fields differing from other
+	static uint32_t fieldBit(const char* name);	// Returns the bit of a field (see changed)
+};
+
+template <typename T>
+constexpr const char* SettingsBaseClass<T>::BLOB_KEY;
+
+/// <summary>
+///  Copies a text into a text member buffer (truncated to the maximum length).
+/// </summary>
+template <typename T>
+void SettingsBaseClass<T>::setText(char* buffer, size_t maxLength, const char* value, size_t length)
+{
+	if (length > maxLength) length = maxLength;
+	memmove(buffer, value, length);
+	buffer[length] = '\0';
+}
+
+/// <summary>
+///  Sets all fields to the default values.
+/// </summary>
+template <typename T>
+void SettingsBaseClass<T>::defaults()
+{
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		switch (field.Type)
+		{
+		case FieldType::Text:
+			setText(field.TextMember(self()), field.MaxLength, field.TextDefault, strlen(field.TextDefault));
+			break;
+		case FieldType::Flag:
+			self().*field.FlagMember = (field.Default != 0);
+			break;
+		case FieldType::Number:
+			self().*field.NumberMember = field.Default;
+			break;
+		}
+	}
+}
+
+/// <summary>
+///  Initializes all data from the non volatile storage (single blob read).
+///  A blob of an older schema version is upgraded (the new fields get the default values).
+///  An invalid blob is kept in storage and the defaults are used (until the next save).
+///  If no blob exists, the fields are read from the legacy keys and migrated to a blob.
+/// </summary>
+template <typename T>
+void SettingsBaseClass<T>::init()
+{
+	uint8_t buffer[blobSize()];
+	uint8_t version = 0;
+	uint32_t start = micros();
+
+	preferences.begin(T::NAMESPACE, false);
+	size_t length = preferences.getBytes(BLOB_KEY, buffer, sizeof(buffer));
+	preferences.end();
+
+	defaults();
+
+	if (unpack(buffer, length, version))
+	{
+		LoadTime = micros() - start;
+		Source = (version == T::VERSION) ? "Blob" : "Upgraded";
+
+		if (version != T::VERSION)
+		{
+			save();
+		}
+
+		return;
+	}
+
+	if (length > 0)
+	{
+		defaults();
+		LoadTime = micros() - start;
+		Source = "Invalid";
+		return;
+	}
+
+	// No blob found: read the legacy keys and migrate.
+
+	start = micros();
+	preferences.begin(T::NAMESPACE, false);
+
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		switch (field.Type)
+		{
+		case FieldType::Text:
+		{
+			char* text = field.TextMember(self());
+
+			if (preferences.getString(field.Name, text, field.MaxLength + 1) == 0)
+			{
+				setText(text, field.MaxLength, field.TextDefault, strlen(field.TextDefault));
+			}
+
+			break;
+		}
+		case FieldType::Flag:
+			self().*field.FlagMember = preferences.getBool(field.Name, field.Default != 0);
+			break;
+		case FieldType::Number:
+			self().*field.NumberMember = preferences.getInt(field.Name, field.Default);
+			break;
+		}
+	}
+
+	preferences.end();
+	LegacyTime = micros() - start;
+	LoadTime = LegacyTime;
+	Source = "Legacy";
+
+	// The blob is written before the legacy keys are removed, so a power loss leaves either.
+
+	save();
+	preferences.begin(T::NAMESPACE, false);
+
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		preferences.remove(field.Name);
+	}
+
+	preferences.end();
+}
+
+/// <summary>
+///  Saves all data to the non volatile storage (single atomic blob write).
+/// </summary>
+template <typename T>
+void SettingsBaseClass<T>::save()
+{
+	uint8_t buffer[blobSize()];
+	size_t length = pack(buffer);
+
+	preferences.begin(T::NAMESPACE, false);
+	size_t written = preferences.putBytes(BLOB_KEY, buffer, length);
+	preferences.end();
+
+	Size = length;
+	Writes = (written == length) ? 1 : 0;
+	++Saves;
+}
+
+/// <summary>
+///  Clears all data on the non volatile storage (blob and legacy keys).
+/// </summary>
+template <typename T>
+void SettingsBaseClass<T>::clear()
+{
+	preferences.begin(T::NAMESPACE, false);
+	preferences.remove(BLOB_KEY);
+
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		preferences.remove(field.Name);
+	}
+
+	preferences.end();
+}
+
+/// <summary>
+///  Returns the maximum blob size (header and packed fields).
+/// </summary>
+template <typename T>
+constexpr size_t SettingsBaseClass<T>::blobSize()
+{
+	return sizeof(SettingsBlobHeader) + fieldBlobSize(T::FIELDS);
+}
+
+/// <summary>
+///  Packs the fields into a blob buffer (texts are stored with a length byte).
+/// </summary>
+/// <param name="buffer">The blob buffer (blobSize bytes)</param>
+/// <returns>The blob length</returns>
+template <typename T>
+size_t SettingsBaseClass<T>::pack(uint8_t* buffer)
+{
+	uint8_t* p = buffer + sizeof(SettingsBlobHeader);
+
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		switch (field.Type)
+		{
+		case FieldType::Text:
+		{
+			const char* text = field.TextMember(self());
+			uint8_t length = (uint8_t)strnlen(text, field.MaxLength);
+			*p++ = length;
+			memcpy(p, text, length);
+			p += length;
+			break;
+		}
+		case FieldType::Flag:
+			*p++ = (self().*field.FlagMember) ? 1 : 0;
+			break;
+		case FieldType::Number:
+		{
+			int32_t value = self().*field.NumberMember;
+			memcpy(p, &value, sizeof(value));
+			p += sizeof(value);
+			break;
+		}
+		}
+	}
+
+	SettingsBlobHeader header;
+	header.Version = T::VERSION;
+	header.Count = (uint8_t)(sizeof(T::FIELDS) / sizeof(T::FIELDS[0]));
+	header.Length = (uint16_t)(p - buffer - sizeof(SettingsBlobHeader));
+	header.CRC = 0;
+	memcpy(buffer, &header, sizeof(header));
+	header.CRC = settingsCrc32(buffer, p - buffer);
+	memcpy(buffer, &header, sizeof(header));
+
+	return p - buffer;
+}
+
+/// <summary>
+///  Unpacks the fields from a blob buffer (checks the schema version, length and CRC first).
+///  A blob of an older schema version holds the fields introduced up to that version (in order),
+///  the other fields are not changed.
+/// </summary>
+/// <param name="buffer">The blob buffer</param>
+/// <param name="length">The blob length</param>
+/// <param name="version">The blob schema version</param>
+/// <returns>True if the blob is valid</returns>
+template <typename T>
+bool SettingsBaseClass<T>::unpack(uint8_t* buffer, size_t length, uint8_t& version)
+{
+	SettingsBlobHeader header;
+
+	if (length < sizeof(header))
+	{
+		return false;
+	}
+
+	memcpy(&header, buffer, sizeof(header));
+	uint8_t count = 0;
+
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		if (field.Since <= header.Version) ++count;
+	}
+
+	if ((header.Version == 0) || (header.Version > T::VERSION) ||
+		(header.Count != count) ||
+		(header.Length != length - sizeof(header)))
+	{
+		return false;
+	}
+
+	uint32_t crc = header.CRC;
+	header.CRC = 0;
+	memcpy(buffer, &header, sizeof(header));
+
+	if (settingsCrc32(buffer, length) != crc)
+	{
+		return false;
+	}
+
+	const uint8_t* p = buffer + sizeof(header);
+	const uint8_t* end = buffer + length;
+
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		if (field.Since > header.Version)
+		{
+			continue;
+		}
+
+		switch (field.Type)
+		{
+		case FieldType::Text:
+		{
+			if ((p >= end) || (*p > field.MaxLength) || (p + 1 + *p > end)) return false;
+			setText(field.TextMember(self()), field.MaxLength, (const char*)(p + 1), *p);
+			p += 1 + *p;
+			break;
+		}
+		case FieldType::Flag:
+			if (p + 1 > end) return false;
+			self().*field.FlagMember = (*p++ != 0);
+			break;
+		case FieldType::Number:
+		{
+			int32_t value;
+			if (p + sizeof(value) > end) return false;
+			memcpy(&value, p, sizeof(value));
+			self().*field.NumberMember = value;
+			p += sizeof(value);
+			break;
+		}
+		}
+	}
+
+	Size = length;
+	version = header.Version;
+	return (p == end);
+}
+
+/// <summary>
+///  Add the storage statistics to a JSON object.
+/// </summary>
+/// <param name="doc">The JSON object</param>
+template <typename T>
+void SettingsBaseClass<T>::serializeStorage(JsonObject doc)
+{
+	doc["Source"] = Source;
+	doc["Version"] = static_cast<int>(T::VERSION);
+	doc["Size"] = Size;
+	doc["LoadTime"] = LoadTime;
+	doc["LegacyTime"] = LegacyTime;
+	doc["Writes"] = Writes;
+	doc["LegacyWrites"] = sizeof(T::FIELDS) / sizeof(T::FIELDS[0]);
+	doc["Saves"] = Saves;
+}
+
+/// <summary>
+///  Compares the fields with another instance (e.g. the running configuration).
+///  Bit i of the result is set if field i of FIELDS differs.
+/// </summary>
+/// <param name="other">The other instance</param>
+/// <returns>The bit mask of the changed fields (0 if equal)</returns>
+template <typename T>
+uint32_t SettingsBaseClass<T>::changed(const T& other)
+{
+	static_assert(sizeof(T::FIELDS) / sizeof(T::FIELDS[0]) <= 32, "Too many fields for the change mask");
+	uint32_t mask = 0;
+	uint32_t bit = 1;
+
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		switch (field.Type)
+		{
+		case FieldType::Text:
+			if (strcmp(field.TextMember(self()), field.TextMember(const_cast<T&>(other))) != 0) mask |= bit;
+			break;
+		case FieldType::Flag:
+			if (self().*field.FlagMember != other.*field.FlagMember) mask |= bit;
+			break;
+		case FieldType::Number:
+			if (self().*field.NumberMember != other.*field.NumberMember) mask |= bit;
+			break;
+		}
+
+		bit <<= 1;
+	}
+
+	return mask;
+}
+
+/// <summary>
+///  Returns the change mask bit of a field.
+/// </summary>
+/// <param name="name">The field name</param>
+/// <returns>The bit (0 if not found)</returns>
+template <typename T>
+uint32_t SettingsBaseClass<T>::fieldBit(const char* name)
+{
+	uint32_t bit = 1;
+
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		if (strcmp(field.Name, name) == 0)
+		{
+			return bit;
+		}
+
+		bit <<= 1;
+	}
+
+	return 0;
+}
+
+/// <summary>
+///  Deserialize the data fields from a JSON string.
+/// </summary>
+/// <param name="json">The JSON string</param>
+/// <returns>True if successful</returns>
+template <typename T>
+bool SettingsBaseClass<T>::deserialize(String json)
+{
+	if (json.length() > 0)
+	{
+		StaticJsonDocument<T::CAPACITY> doc;
+		DeserializationError err = deserializeJson(doc, json);
+
+		if (err)
+		{
+			return false;
+		}
+
+		return deserialize(doc.template as<JsonObject>());
+	}
+
+	return false;
+}
+
+/// <summary>
+///  Deserialize the data fields from a JSON object (missing fields are not changed).
+///  Texts are truncated to the maximum length, numbers are clamped to the range.
+/// </summary>
+/// <param name="doc">The JSON object</param>
+/// <returns>True if successful</returns>
+template <typename T>
+bool SettingsBaseClass<T>::deserialize(JsonObject doc)
+{
+	if (doc.isNull())
+	{
+		return false;
+	}
+
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		switch (field.Type)
+		{
+		case FieldType::Text:
+		{
+			const char* text = doc[field.Name] | (const char*)NULL;
+
+			if (text != NULL)
+			{
+				setText(field.TextMember(self()), field.MaxLength, text, strnlen(text, field.MaxLength));
+			}
+
+			break;
+		}
+		case FieldType::Flag:
+			self().*field.FlagMember = doc[field.Name] | self().*field.FlagMember;
+			break;
+		case FieldType::Number:
+		{
+			int value = doc[field.Name] | self().*field.NumberMember;
+			self().*field.NumberMember = constrain(value, field.Minimum, field.Maximum);
+			break;
+		}
+		}
+	}
+
+	return true;
+}
+
+/// <summary>
+///  Serialize the class instance to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+template <typename T>
+String SettingsBaseClass<T>::serialize()
+{
+	StaticJsonDocument<T::CAPACITY> doc;
+	String json;
+
+	serialize(doc.template to<JsonObject>());
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Add the data fields to a JSON object.
+/// </summary>
+/// <param name="doc">The JSON object</param>
+template <typename T>
+void SettingsBaseClass<T>::serialize(JsonObject doc)
+{
+	for (const FieldDescriptor<T>& field : T::FIELDS)
+	{
+		switch (field.Type)
+		{
+		case FieldType::Text:
+			doc[field.Name] = field.TextMember(self());
+			break;
+		case FieldType::Flag:
+			doc[field.Name] = self().*field.FlagMember;
+			break;
+		case FieldType::Number:
+			doc[field.Name] = self().*field.NumberMember;
+			break;
+		}
+	}
+}
@@ -0,0 +1,218 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="SmartConfig.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+#include <esp_wifi.h>
+#include <esp_smartconfig.h>
+
+#include "SmartConfig.h"
+
+// Flag set by the SmartConfig callback when the credentials have been received (WiFi task).
+static volatile bool received = false;
+
+/// <summary>
+///  The SmartConfig callback: connects the station with the received credentials (see WiFiSTAClass).
+/// </summary>
+/// <param name="status">The SmartConfig status</param>
+/// <param name="data">The status data (the station configuration for SC_STATUS_LINK)</param>
+static void callback(smartconfig_status_t status, void* data)
+{
+	if (status == SC_STATUS_LINK)
+	{
+		wifi_config_t* config = reinterpret_cast<wifi_config_t*>(data);
+
+		esp_wifi_disconnect();
+		esp_wifi_set_config(ESP_IF_WIFI_STA, config);
+		esp_wifi_connect();
+		received = true;
+	}
+	else if (status == SC_STATUS_LINK_OVER)
+	{
+		esp_smartconfig_stop();
+	}
+}
+
+/// <summary>
+///  Starts the SmartConfig (the station is disconnected, the access point is kept enabled).
+///  WiFi.beginSmartConfig() switches to station mode (tearing down the access point), so the
+///  SmartConfig is started directly in station or access point + station mode.
+/// </summary>
+/// <returns>True if started</returns>
+bool SmartConfigClass::start()
+{
+	if (running())
+	{
+		return false;
+	}
+
+	lock.lock();
+	Started = millis();
+	Changed = Started;
+	Elapsed = 0;
+	Result = "";
+	SSID = "";
+	PASS = "";
+	lock.unlock();
+
+	received = false;
+
+	if (WiFi.isConnected())
+	{
+		WiFi.disconnect();
+	}
+
+	if (!WiFi.enableSTA(true) || (esp_smartconfig_start(callback, 0) != ESP_OK))
+	{
+		lock.lock();
+		Status = Failed;
+		Result = "SmartConfig not started";
+		lock.unlock();
+		return false;
+	}
+
+	lock.lock();
+	Status = Waiting;
+	lock.unlock();
+	Serial.println("Waiting for SmartConfig.");
+
+	return true;
+}
+
+/// <summary>
+///  Advances the state machine (called from loop, never blocks).
+/// </summary>
+/// <returns>True if the provisioning has finished (Connected or Failed)</returns>
+bool SmartConfigClass::update()
+{
+	unsigned long now = millis();
+
+	switch (Status)
+	{
+	case Waiting:
+		if (received)
+		{
+			Serial.println("SmartConfig received.");
+			lock.lock();
+			Status = Connecting;
+			Changed = now;
+			lock.unlock();
+		}
+		else if (now - Changed > WAIT_TIMEOUT)
+		{
+			Result = "No SmartConfig received";
+			stop();
+			return true;
+		}
+		break;
+
+	case Connecting:
+		if (WiFi.status() == WL_CONNECTED)
+		{
+			wifi_config_t config;
+			esp_wifi_get_config(WIFI_IF_STA, &config);
+			lock.lock();
+			SSID.assign(reinterpret_cast<const char*>(config.sta.ssid));
+			PASS.assign(reinterpret_cast<const char*>(config.sta.password));
+			Status = Connected;
+			Result = "Connected";
+			Elapsed = now - Started;
+			lock.unlock();
+			return true;
+		}
+		else if (now - Changed > CONNECT_TIMEOUT)
+		{
+			Result = "Connection failed";
+			stop();
+			return true;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return false;
+}
+
+/// <summary>
+///  Stops the provisioning (the state is Failed).
+/// </summary>
+void SmartConfigClass::stop()
+{
+	esp_smartconfig_stop();
+
+	lock.lock();
+	Status = Failed;
+	Elapsed = millis() - Started;
+
+	if (Result[0] == '\0')
+	{
+		Result = "Stopped";
+	}
+
+	lock.unlock();
+}
+
+/// <summary>
+///  Returns true if the provisioning is running.
+/// </summary>
+bool SmartConfigClass::running()
+{
+	return (Status == Waiting) || (Status == Connecting);
+}
+
+/// <summary>
+///  Returns the name of a phase.
+/// </summary>
+/// <param name="phase">The phase</param>
+/// <returns>The name</returns>
+const char* SmartConfigClass::name(Phase phase)
+{
+	switch (phase)
+	{
+	case Waiting: return "Waiting";
+	case Connecting: return "Connecting";
+	case Connected: return "Connected";
+	case Failed: return "Failed";
+	default: return "Idle";
+	}
+}
+
+/// <summary>
+///  Serialize the progress to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String SmartConfigClass::serialize()
+{
+	StaticJsonDocument<JSON_OBJECT_SIZE(6) + 33> doc;
+	String json;
+
+	lock.lock();
+	Phase status = Status;
+	const char* result = Result;
+	unsigned long started = Started;
+	unsigned long changed = Changed;
+	unsigned long elapsed = Elapsed;
+	FixedString<32> ssid = SSID;
+	lock.unlock();
+
+	bool running = (status == Waiting) || (status == Connecting);
+	unsigned long now = millis();
+
+	doc["Phase"] = name(status);
+	doc["Elapsed"] = running ? now - started : elapsed;
+	doc["Timeout"] = (status == Connecting) ? (unsigned long)CONNECT_TIMEOUT : (unsigned long)WAIT_TIMEOUT;
+	doc["PhaseElapsed"] = running ? now - changed : 0;
+	doc["Result"] = result;
+	doc["SSID"] = ssid.buffer();
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
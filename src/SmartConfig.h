@@ -0,0 +1,61 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="SmartConfig.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <WiFi.h>
+
+#include "FixedString.h"
+#include "SnapshotLock.h"
+
+/// <summary>
+/// This class runs the ESP32 SmartConfig provisioning as a state machine advanced by the main task (loop).
+/// Nothing blocks: the access point, the web server and the LED keep running while waiting. Note that
+/// the packet sniffer hops channels, so clients of the access point may lose their link until the
+/// credentials have been received (or the wait has timed out).
+/// The progress is written by the main task under a lock and copied by the handlers (see /smart).
+/// </summary>
+class SmartConfigClass
+{
+public:
+	static const unsigned long WAIT_TIMEOUT = 60000;		// The maximum time waiting for the SmartConfig packet (msec)
+	static const unsigned long CONNECT_TIMEOUT = 10000;		// The maximum time connecting to the network (msec)
+
+	/// <summary>
+	/// The provisioning phases.
+	/// </summary>
+	enum Phase
+	{
+		Idle,									// Not started
+		Waiting,								// Waiting for the SmartConfig packet
+		Connecting,								// Connecting with the received credentials
+		Connected,								// Connected (credentials received)
+		Failed									// Failed (see Result)
+	};
+
+private:
+	SnapshotLock lock;							// Guards the progress read by the handlers
+
+public:
+	Phase Status = Idle;						// The current phase
+	const char* Result = "";					// The result of the last run
+	unsigned long Started = 0;					// The start time (msec)
+	unsigned long Changed = 0;					// The time of the last phase change (msec)
+	unsigned long Elapsed = 0;					// The duration of the last run (msec)
+	FixedString<32> SSID;						// The received SSID
+	FixedString<64> PASS;						// The received passphrase
+
+	bool start();								// Starts the provisioning
+	bool update();								// Advances the state machine (returns true when finished)
+	void stop();								// Stops the provisioning (failed)
+	bool running();								// Returns true if waiting or connecting
+
+	static const char* name(Phase phase);		// Returns the name of the phase
+
+	String serialize();							// Return a string serialization (JSON)
+};
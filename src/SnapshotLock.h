@@ -0,0 +1,40 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="SnapshotLock.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+#include <freertos/portmacro.h>
+#else
+#include <mutex>
+#endif
+
+/// <summary>
+/// A short critical section guarding the copy of a published snapshot (plain old data only, no blocking calls).
+/// On the ESP32 this is a FreeRTOS spinlock (portENTER_CRITICAL), so a higher priority reader can never
+/// preempt the writer in the middle of a copy and wait for it. On the host it is a mutex.
+/// </summary>
+class SnapshotLock
+{
+private:
+#ifdef ARDUINO
+	portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;	// The spinlock
+#else
+	std::mutex mutex;									// The mutex
+#endif
+
+public:
+#ifdef ARDUINO
+	void lock() { portENTER_CRITICAL(&mux); }			// Enters the critical section
+	void unlock() { portEXIT_CRITICAL(&mux); }			// Leaves the critical section
+#else
+	void lock() { mutex.lock(); }						// Enters the critical section
+	void unlock() { mutex.unlock(); }					// Leaves the critical section
+#endif
+};
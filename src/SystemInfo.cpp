@@ -13,25 +13,44 @@
 
 #include "SystemInfo.h"
 
+bool SystemInfoClass::initialized = false;
+int SystemInfoClass::ChipRevision = 0;
+int SystemInfoClass::CpuFreqMHz = 0;
+int SystemInfoClass::FlashChipSpeed = 0;
+int SystemInfoClass::FlashChipSize = 0;
+int SystemInfoClass::HeapSize = 0;
+int SystemInfoClass::SketchSize = 0;
+int SystemInfoClass::FreeSketchSpace = 0;
+char SystemInfoClass::SketchMD5[33] = "";
+const char* SystemInfoClass::SdkVersion = "";
+char SystemInfoClass::ChipID[13] = "";
+const char* SystemInfoClass::Software = "";
+
 /// <summary>
-///  Using the global ESP instance to get the actual data.
+///  Using the global ESP instance to compute the immutable data once.
+///  Note that ESP.getSketchMD5() reads and hashes the complete application image.
 /// </summary>
-SystemInfoClass::SystemInfoClass()
+void SystemInfoClass::init()
 {
+	if (initialized)
+	{
+		return;
+	}
+
 	ChipRevision = ESP.getChipRevision();
 	CpuFreqMHz = ESP.getCpuFreqMHz();
 	FlashChipSpeed = ESP.getFlashChipSpeed() / 1000000;
 	FlashChipSize = ESP.getFlashChipSize() / 1000;
 	HeapSize = ESP.getHeapSize() / 1000;
-	FreeHeap = ESP.getFreeHeap() / 1000;
 	SketchSize = ESP.getSketchSize() / 1000;
 	FreeSketchSpace = ESP.getFreeSketchSpace() / 1000;
-	SketchMD5 = ESP.getSketchMD5();
-	SdkVersion = String(ESP.getSdkVersion());
+	SdkVersion = ESP.getSdkVersion();
+	Software = SOFTWARE_VERSION;
+
+	strlcpy(SketchMD5, ESP.getSketchMD5().c_str(), sizeof(SketchMD5));
 
 	uint64_t mac = ESP.getEfuseMac();
 	uint8_t bytes[6];
-	char chipid[13];
 
 	bytes[0] = (mac >> 40) & 0xFF;
 	bytes[1] = (mac >> 32) & 0xFF;
@@ -40,10 +59,20 @@ SystemInfoClass::SystemInfoClass()
 	bytes[4] = (mac >> 8) & 0xFF;
 	bytes[5] = (mac >> 0) & 0xFF;
 
-	sprintf(chipid, "%02X%02X%02X%02X%02X%02X", bytes[5], bytes[4], bytes[3], bytes[2], bytes[1], bytes[0]);
+	snprintf(ChipID, sizeof(ChipID), "%02X%02X%02X%02X%02X%02X", bytes[5], bytes[4], bytes[3], bytes[2], bytes[1], bytes[0]);
+
+	initialized = true;
+}
 
-	ChipID = String(chipid);
-	Software = String(SOFTWARE_VERSION);
+/// <summary>
+///  Samples the volatile data (the immutable data is computed on first use).
+/// </summary>
+SystemInfoClass::SystemInfoClass()
+{
+	init();
+
+	FreeHeap = ESP.getFreeHeap() / 1000;
+	Uptime = millis() / 1000;
 }
 
 /// <summary>
@@ -52,10 +81,21 @@ SystemInfoClass::SystemInfoClass()
 /// <returns>The JSON string</returns>
 String SystemInfoClass::serialize()
 {
-	const int capacity = JSON_OBJECT_SIZE(11) + 205;
-	StaticJsonDocument<capacity> doc;
+	StaticJsonDocument<CAPACITY> doc;
 	String json;
 
+	serialize(doc.to<JsonObject>());
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Add the data fields to a JSON object.
+/// </summary>
+/// <param name="doc">The JSON object</param>
+void SystemInfoClass::serialize(JsonObject doc)
+{
 	doc["ChipRevision"] = ChipRevision;
 	doc["CpuFreqMHz"] = CpuFreqMHz;
 	doc["FlashChipSpeed"] = FlashChipSpeed;
@@ -64,14 +104,11 @@ String SystemInfoClass::serialize()
 	doc["FreeHeap"] = FreeHeap;
 	doc["SketchSize"] = SketchSize;
 	doc["FreeSketchSpace"] = FreeSketchSpace;
-	doc["SketchMD5"] = SketchMD5;
+	doc["SketchMD5"] = (const char*)SketchMD5;
 	doc["SdkVersion"] = SdkVersion;
-	doc["ChipID"] = ChipID;
+	doc["ChipID"] = (const char*)ChipID;
 	doc["Software"] = Software;
-
-	serializeJsonPretty(doc, json);
-
-	return json;
+	doc["Uptime"] = Uptime;
 }
 
 /// <summary>
@@ -92,5 +129,6 @@ void SystemInfoClass::print()
 	Serial.print("    SdkVersion:      "); Serial.println(SdkVersion);
 	Serial.print("    ChipID:          "); Serial.println(ChipID);
 	Serial.print("    Software:        "); Serial.println(Software);
+	Serial.print("    Uptime:          "); Serial.println(Uptime);
 }
 
@@ -8,31 +8,44 @@
 // --------------------------------------------------------------------------------------------------------------------
 #pragma once
 
+#include <ArduinoJson.h>
+
 /// <summary>
 /// This class holds the current system data.
-/// Note that if this class is instanciated before the sketch information is available 
-/// the getSketchXXX() functions crashes (abort()). So this class has to be instantiated later.
+/// The immutable fields (chip, flash and sketch data) are computed once into a static snapshot (see init()),
+/// only the volatile fields (free heap, uptime) are sampled when an instance is created.
+/// Note that if init() is called before the sketch information is available 
+/// the getSketchXXX() functions crashes (abort()). So init() has to be called later (setup).
 /// </summary>
 class SystemInfoClass
 {
+private:
+	static bool initialized;				// The immutable fields have been computed
+
 public:
 	static char* SOFTWARE_VERSION;			// The software versionstring with date (see .ino)
+	static const int CAPACITY = JSON_OBJECT_SIZE(13);	// The JSON document capacity
+
+	static void init();						// Compute the immutable fields (once)
+
+	static int ChipRevision;				// The chip revision
+	static int CpuFreqMHz;					// The CPU frequency in MHz
+	static int FlashChipSpeed;				// The flash chip speed in MHz
+	static int FlashChipSize;				// The flash chip size in kB
+	static int HeapSize;					// The total heap size in kB
+	static int SketchSize;					// The sketch size in kB
+	static int FreeSketchSpace;				// The free sketch space in kB
+	static char SketchMD5[33];				// The MD5 of the current sketch
+	static const char* SdkVersion;			// The espressif SDK version
+	static char ChipID[13];					// Board identifier (MAC address)
+	static const char* Software;			// Software version and date
 
-	SystemInfoClass();						// Initialize the system info fields
+	SystemInfoClass();						// Sample the volatile system info fields
 
-	int ChipRevision;						// The chip revision
-	int CpuFreqMHz;							// The CPU frequency in MHz
-	int FlashChipSpeed;						// The flash chip speed in MHz
-	int FlashChipSize;						// The flash chip size in kB
-	int HeapSize;							// The total heap size in kB
 	int FreeHeap;							// The amount of free heap kB
-	int SketchSize;							// The sketch size in kB
-	int FreeSketchSpace;					// The free sketch space in kB
-	String SketchMD5;						// The MD5 of the current sketch
-	String SdkVersion;						// The espressif SDK version
-	String ChipID;							// Board identifier (MAC address)
-	String Software;						// Software version and date
+	unsigned long Uptime;					// The time since boot in seconds
 
 	String serialize();						// Return a string serialization (JSON)
+	void serialize(JsonObject doc);			// Add the fields to a JSON object
 	void print();							// Prints all fields on the serial line
 };
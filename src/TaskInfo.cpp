@@ -0,0 +1,301 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="TaskInfo.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+#include <esp_freertos_hooks.h>
+#include <esp_timer.h>
+
+#include "SnapshotLock.h"
+#include "TaskInfo.h"
+
+TaskStatus_t TaskInfoClass::status[TaskInfoClass::MAX_STATUS];
+TaskEntry TaskInfoClass::Tasks[TaskInfoClass::MAX_TASKS];
+
+// The longest gap between two idle hook calls counted as idle (usec). An idle core waits for the next
+// interrupt at least once per tick, a longer gap has been taken by another task.
+static const int64_t IDLE_GAP = 1500 * portTICK_PERIOD_MS;
+
+/// <summary>
+/// The idle time measured by the idle hooks (written on each core, read by the async_tcp task).
+/// </summary>
+static struct
+{
+	SnapshotLock lock;						// The lock guarding the times
+	int64_t Started;						// The time the hooks have been registered (usec)
+	int64_t Last[portNUM_PROCESSORS];		// The time of the last hook call per core (usec)
+	int64_t Idle[portNUM_PROCESSORS];		// The idle time per core (usec)
+	int64_t Time;							// The time of the previous snapshot (async_tcp task only)
+	int64_t Previous[portNUM_PROCESSORS];	// The idle time of the previous snapshot (async_tcp task only)
+} hooks;
+
+/// <summary>
+///  The idle hook: the time since the previous call is counted as idle, unless another task has run in between
+///  (a gap longer than IDLE_GAP). A task running for less than a tick after a wakeup is counted as idle,
+///  so the result is an estimate (an upper bound).
+/// </summary>
+/// <returns>True (the idle task waits for the next interrupt)</returns>
+static bool idleHook()
+{
+	int core = xPortGetCoreID();
+	int64_t now = esp_timer_get_time();
+
+	hooks.lock.lock();
+
+	if ((hooks.Last[core] != 0) && (now - hooks.Last[core] < IDLE_GAP))
+	{
+		hooks.Idle[core] += now - hooks.Last[core];
+	}
+
+	hooks.Last[core] = now;
+	hooks.lock.unlock();
+
+	return true;
+}
+
+#if (configGENERATE_RUN_TIME_STATS == 1)
+/// <summary>
+/// The run time counters of the previous snapshot (async_tcp task only).
+/// </summary>
+static struct
+{
+	uint32_t Total;							// The total run time counter
+	uint32_t Idle[portNUM_PROCESSORS];		// The idle task run time counters
+	int Count;								// The number of tasks
+	UBaseType_t Number[TaskInfoClass::MAX_TASKS];	// The task numbers
+	uint32_t RunTime[TaskInfoClass::MAX_TASKS];		// The task run time counters
+} previous;
+#endif
+
+/// <summary>
+///  Using the FreeRTOS system state to get the actual data.
+/// </summary>
+TaskInfoClass::TaskInfoClass()
+{
+	uint32_t total = 0;
+
+	Total = uxTaskGetNumberOfTasks();
+	int captured = (Total <= MAX_STATUS) ? uxTaskGetSystemState(status, MAX_STATUS, &total) : 0;
+	Count = (captured < MAX_TASKS) ? captured : MAX_TASKS;
+	Truncated = (Count < Total);
+	RunTimeStats = (configGENERATE_RUN_TIME_STATS == 1) && (total > 0);
+	Elapsed = 0;
+
+	for (int core = 0; core < portNUM_PROCESSORS; ++core)
+	{
+		Idle[core] = -1;
+		IdleInterval[core] = -1;
+	}
+
+	if (!RunTimeStats && (hooks.Started != 0))
+	{
+		int64_t idle[portNUM_PROCESSORS];
+		int64_t now = esp_timer_get_time();
+
+		hooks.lock.lock();
+		memcpy(idle, hooks.Idle, sizeof(idle));
+		hooks.lock.unlock();
+
+		Elapsed = (uint32_t)(now - hooks.Time);
+
+		for (int core = 0; core < portNUM_PROCESSORS; ++core)
+		{
+			Idle[core] = (100.0f * idle[core]) / (now - hooks.Started);
+			IdleInterval[core] = (now > hooks.Time) ? (100.0f * (idle[core] - hooks.Previous[core])) / (now - hooks.Time) : Idle[core];
+		}
+
+		hooks.Time = now;
+		memcpy(hooks.Previous, idle, sizeof(idle));
+	}
+
+	for (int i = 0; i < Count; ++i)
+	{
+		TaskEntry& task = Tasks[i];
+
+		strlcpy(task.Name, status[i].pcTaskName, sizeof(task.Name));
+		task.Number = status[i].xTaskNumber;
+		task.State = status[i].eCurrentState;
+		task.Priority = status[i].uxCurrentPriority;
+#if (configTASKLIST_INCLUDE_COREID == 1)
+		task.Core = (status[i].xCoreID < portNUM_PROCESSORS) ? (int)status[i].xCoreID : -1;
+#else
+		task.Core = -1;
+#endif
+		task.HighWaterMark = status[i].usStackHighWaterMark;
+		task.RunTime = 0;
+		task.Share = 0;
+		task.Interval = 0;
+	}
+
+#if (configGENERATE_RUN_TIME_STATS == 1)
+	if (!RunTimeStats)
+	{
+		return;
+	}
+
+	// The run time counter advances on every core, the task shares are relative to all cores.
+	uint32_t idle[portNUM_PROCESSORS] = {};
+	Elapsed = total - previous.Total;
+
+	for (int i = 0; i < Count; ++i)
+	{
+		TaskEntry& task = Tasks[i];
+		uint32_t last = 0;
+
+		task.RunTime = status[i].ulRunTimeCounter;
+		task.Share = (100.0f * task.RunTime) / ((float)total * portNUM_PROCESSORS);
+
+		for (int j = 0; j < previous.Count; ++j)
+		{
+			if (previous.Number[j] == task.Number)
+			{
+				last = previous.RunTime[j];
+				break;
+			}
+		}
+
+		task.Interval = (Elapsed > 0) ? (100.0f * (task.RunTime - last)) / ((float)Elapsed * portNUM_PROCESSORS) : 0;
+
+		previous.Number[i] = task.Number;
+		previous.RunTime[i] = task.RunTime;
+	}
+
+	// The idle tasks are looked up in all captured tasks (they may not be reported).
+	for (int i = 0; i < captured; ++i)
+	{
+		for (int core = 0; core < portNUM_PROCESSORS; ++core)
+		{
+			if (status[i].xHandle == xTaskGetIdleTaskHandleForCPU(core))
+			{
+				uint32_t time = status[i].ulRunTimeCounter;
+
+				idle[core] = time;
+				Idle[core] = (100.0f * time) / total;
+				IdleInterval[core] = (Elapsed > 0) ? (100.0f * (time - previous.Idle[core])) / Elapsed : Idle[core];
+			}
+		}
+	}
+
+	previous.Total = total;
+	previous.Count = Count;
+	memcpy(previous.Idle, idle, sizeof(idle));
+#endif
+}
+
+/// <summary>
+///  Registers the idle hooks measuring the idle time per core (used without run time statistics).
+/// </summary>
+void TaskInfoClass::begin()
+{
+	if (configGENERATE_RUN_TIME_STATS == 1)
+	{
+		return;
+	}
+
+	hooks.Started = esp_timer_get_time();
+	hooks.Time = hooks.Started;
+
+	for (int core = 0; core < portNUM_PROCESSORS; ++core)
+	{
+		if (esp_register_freertos_idle_hook_for_cpu(idleHook, core) != ESP_OK)
+		{
+			Serial.printf("Idle hook not registered on core %d\n", core);
+		}
+	}
+}
+
+/// <summary>
+///  Returns the name of a task state.
+/// </summary>
+/// <param name="state">The task state</param>
+/// <returns>The state name</returns>
+const char* TaskInfoClass::stateName(eTaskState state)
+{
+	switch (state)
+	{
+	case eRunning: return "Running";
+	case eReady: return "Ready";
+	case eBlocked: return "Blocked";
+	case eSuspended: return "Suspended";
+	case eDeleted: return "Deleted";
+	default: return "Invalid";
+	}
+}
+
+/// <summary>
+///  Serialize the TaskInfoClass instance to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String TaskInfoClass::serialize()
+{
+	StaticJsonDocument<CAPACITY> doc;
+	String json;
+
+	serialize(doc.to<JsonObject>());
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Add the snapshot to a JSON object.
+/// </summary>
+/// <param name="doc">The JSON object</param>
+void TaskInfoClass::serialize(JsonObject doc)
+{
+	doc["RunTimeStats"] = RunTimeStats;
+	doc["Total"] = Total;
+	doc["Truncated"] = Truncated;
+	doc["Elapsed"] = Elapsed;
+
+	JsonArray idle = doc.createNestedArray("Idle");
+	JsonArray interval = doc.createNestedArray("IdleInterval");
+
+	for (int core = 0; core < portNUM_PROCESSORS; ++core)
+	{
+		idle.add(Idle[core]);
+		interval.add(IdleInterval[core]);
+	}
+
+	JsonArray tasks = doc.createNestedArray("Tasks");
+
+	for (int i = 0; i < Count; ++i)
+	{
+		JsonObject task = tasks.createNestedObject();
+
+		task["Name"] = (const char*)Tasks[i].Name;
+		task["State"] = stateName(Tasks[i].State);
+		task["Priority"] = Tasks[i].Priority;
+		task["Core"] = Tasks[i].Core;
+		task["Stack"] = Tasks[i].HighWaterMark;
+		task["RunTime"] = Tasks[i].RunTime;
+		task["Share"] = Tasks[i].Share;
+		task["Interval"] = Tasks[i].Interval;
+	}
+}
+
+/// <summary>
+///  Prints the TaskInfoClass instance data on the Serial stream.
+/// </summary>
+void TaskInfoClass::print()
+{
+	Serial.println("Task Info:");
+	Serial.print("    Tasks:        "); Serial.print(Total); Serial.println(Truncated ? " (truncated)" : "");
+
+	for (int core = 0; core < portNUM_PROCESSORS; ++core)
+	{
+		Serial.printf("    Idle core %d:  %.1f%%\n", core, Idle[core]);
+	}
+
+	for (int i = 0; i < Count; ++i)
+	{
+		Serial.printf("    %-16s %-9s %2u %2d %6u %5.1f%%\n", Tasks[i].Name, stateName(Tasks[i].State),
+			Tasks[i].Priority, Tasks[i].Core, Tasks[i].HighWaterMark, Tasks[i].Share);
+	}
+}
@@ -0,0 +1,71 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="TaskInfo.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+/// <summary>
+/// This structure holds the data of a single FreeRTOS task (see uxTaskGetSystemState).
+/// </summary>
+struct TaskEntry
+{
+	char Name[configMAX_TASK_NAME_LEN];		// The task name
+	UBaseType_t Number;						// The task number (unique)
+	eTaskState State;						// The task state
+	UBaseType_t Priority;					// The current priority
+	int Core;								// The core affinity (-1 if not pinned or unknown)
+	uint32_t HighWaterMark;					// The minimum free stack in bytes
+	uint32_t RunTime;						// The run time counter (since boot)
+	float Share;							// The CPU share since boot (percent of all cores)
+	float Interval;							// The CPU share since the previous snapshot (percent of all cores)
+};
+
+/// <summary>
+/// This class holds a snapshot of the FreeRTOS tasks (the first MAX_TASKS, see Truncated) and the per
+/// core idle percentage. The CPU shares require the run time statistics (CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS),
+/// without them the task states, priorities and stacks are reported and the idle percentage is estimated
+/// by the idle hooks (see begin()).
+/// The interval shares cover the time since the previous snapshot (e.g. a page load burst
+/// between two /tasks requests). Snapshots are taken by the async_tcp task only, the task buffers
+/// are static (kept off the web server stack) and valid until the next snapshot.
+/// </summary>
+class TaskInfoClass
+{
+public:
+	static const int MAX_TASKS = 20;		// The maximum number of tasks reported
+	static const int MAX_STATUS = 32;		// The maximum number of tasks in the system state
+	static const int CAPACITY = JSON_OBJECT_SIZE(7) + 2 * JSON_ARRAY_SIZE(portNUM_PROCESSORS) +
+		JSON_ARRAY_SIZE(MAX_TASKS) + MAX_TASKS * JSON_OBJECT_SIZE(8);	// The JSON document capacity
+
+private:
+	static TaskStatus_t status[MAX_STATUS];	// The FreeRTOS system state
+
+public:
+	TaskInfoClass();						// Takes the snapshot
+
+	static void begin();					// Registers the idle hooks (call in setup)
+
+	bool RunTimeStats;						// The run time statistics are available
+	bool Truncated;							// Not all tasks are reported (more than MAX_TASKS)
+	int Count;								// The number of tasks reported
+	int Total;								// The number of tasks running
+	uint32_t Elapsed;						// The run time counter (or usec without run time statistics) since the previous snapshot
+	float Idle[portNUM_PROCESSORS];			// The idle percentage per core since boot (-1 if unknown)
+	float IdleInterval[portNUM_PROCESSORS];	// The idle percentage per core since the previous snapshot (-1 if unknown)
+	static TaskEntry Tasks[MAX_TASKS];		// The tasks of the last snapshot
+
+	static const char* stateName(eTaskState state);
+
+	String serialize();						// Return a string serialization (JSON)
+	void serialize(JsonObject doc);			// Add the fields to a JSON object
+	void print();							// Prints all fields on the serial line
+};
@@ -0,0 +1,251 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Telemetry.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+#include <ESP.h>
+#include <esp_wifi.h>
+
+#include "Telemetry.h"
+
+/// <summary>
+///  Initializes the snapshot and the history.
+/// </summary>
+TelemetryClass::TelemetryClass()
+{
+	memset(&data, 0, sizeof(data));
+	memset(history, 0, sizeof(history));
+}
+
+/// <summary>
+///  Starts the low priority sampler task.
+/// </summary>
+/// <param name="interval">The sample interval (msec)</param>
+void TelemetryClass::begin(uint32_t interval)
+{
+	this->interval = interval;
+	sample();
+	xTaskCreatePinnedToCore(run, "telemetry", 3072, this, 1, NULL, ARDUINO_RUNNING_CORE);
+}
+
+/// <summary>
+///  The sampler task function.
+/// </summary>
+/// <param name="parameter">The TelemetryClass instance</param>
+void TelemetryClass::run(void* parameter)
+{
+	TelemetryClass* telemetry = static_cast<TelemetryClass*>(parameter);
+	TickType_t wake = xTaskGetTickCount();
+
+	for (;;)
+	{
+		vTaskDelayUntil(&wake, pdMS_TO_TICKS(telemetry->interval));
+		telemetry->sample();
+	}
+}
+
+/// <summary>
+///  Samples the WiFi and heap data into a local copy, then publishes it under the lock.
+/// </summary>
+void TelemetryClass::sample()
+{
+	TelemetryData current;
+	wifi_config_t config;
+	uint8_t mac[6];
+
+	memset(&current, 0, sizeof(current));
+	current.Samples = data.Samples + 1;
+	current.Time = millis();
+	current.FreeHeap = ESP.getFreeHeap();
+
+	if (esp_wifi_get_config(WIFI_IF_AP, &config) == ESP_OK)
+	{
+		current.Ap.SSID.assign(reinterpret_cast<const char*>(config.ap.ssid));
+		current.Ap.PASS.assign(reinterpret_cast<const char*>(config.ap.password));
+	}
+
+	current.Ap.Hostname.assign(WiFi.softAPgetHostname());
+	formatAddress(current.Ap.NetworkID, WiFi.softAPNetworkID());
+	formatAddress(current.Ap.Address, WiFi.softAPIP());
+	current.Ap.Clients = WiFi.softAPgetStationNum();
+	formatMAC(current.Ap.MAC, WiFi.softAPmacAddress(mac));
+
+	if (esp_wifi_get_config(WIFI_IF_STA, &config) == ESP_OK)
+	{
+		current.WiFi.SSID.assign(reinterpret_cast<const char*>(config.sta.ssid));
+		current.WiFi.PASS.assign(reinterpret_cast<const char*>(config.sta.password));
+	}
+
+	current.WiFi.Hostname.assign(WiFi.getHostname());
+	formatAddress(current.WiFi.NetworkID, WiFi.networkID());
+	formatAddress(current.WiFi.Address, WiFi.localIP());
+	formatAddress(current.WiFi.Gateway, WiFi.gatewayIP());
+	formatAddress(current.WiFi.Subnet, WiFi.subnetMask());
+	formatAddress(current.WiFi.DNS, WiFi.dnsIP());
+	current.WiFi.RSSI = WiFi.RSSI();
+	formatMAC(current.WiFi.BSSID, WiFi.BSSID());
+	formatMAC(current.WiFi.MAC, WiFi.macAddress(mac));
+
+	// Publish the snapshot (and every HISTORY_DECIMATION samples a history entry).
+	lock.lock();
+
+	data = current;
+
+	if ((current.Samples % HISTORY_DECIMATION) == 1)
+	{
+		TelemetrySample& entry = history[next];
+
+		entry.Time = current.Time / 1000;
+		entry.RSSI = (int8_t)current.WiFi.RSSI;
+		entry.Clients = (uint8_t)current.Ap.Clients;
+		entry.FreeHeap = (uint16_t)(current.FreeHeap / 1000);
+
+		next = (next + 1) % HISTORY_SIZE;
+		if (count < HISTORY_SIZE) ++count;
+	}
+
+	lock.unlock();
+}
+
+/// <summary>
+///  Copies the current snapshot.
+/// </summary>
+/// <param name="snapshot">The snapshot copy</param>
+void TelemetryClass::read(TelemetryData& snapshot)
+{
+	lock.lock();
+	snapshot = data;
+	lock.unlock();
+}
+
+/// <summary>
+///  Copies the history entries (oldest first).
+/// </summary>
+/// <param name="samples">The buffer (HISTORY_SIZE entries)</param>
+/// <returns>The number of entries copied</returns>
+int TelemetryClass::read(TelemetrySample* samples)
+{
+	lock.lock();
+
+	int n = count;
+	int first = (next - n + HISTORY_SIZE) % HISTORY_SIZE;
+
+	for (int i = 0; i < n; i++)
+	{
+		samples[i] = history[(first + i) % HISTORY_SIZE];
+	}
+
+	lock.unlock();
+
+	return n;
+}
+
+/// <summary>
+///  Serialize the sampled access point data to a JSON string (same fields as ApInfoClass).
+/// </summary>
+/// <returns>The JSON string</returns>
+String TelemetryClass::serializeAp()
+{
+	StaticJsonDocument<AP_CAPACITY> doc;
+	String json;
+
+	serializeAp(doc.to<JsonObject>());
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Add the sampled access point data to a JSON object (the strings are copied).
+/// </summary>
+/// <param name="doc">The JSON object</param>
+void TelemetryClass::serializeAp(JsonObject doc)
+{
+	TelemetryData snapshot;
+	read(snapshot);
+
+	doc["SSID"] = snapshot.Ap.SSID.buffer();
+	doc["PASS"] = snapshot.Ap.PASS.buffer();
+	doc["Hostname"] = snapshot.Ap.Hostname.buffer();
+	doc["NetworkID"] = snapshot.Ap.NetworkID.buffer();
+	doc["Address"] = snapshot.Ap.Address.buffer();
+	doc["Clients"] = snapshot.Ap.Clients;
+	doc["MAC"] = snapshot.Ap.MAC.buffer();
+}
+
+/// <summary>
+///  Serialize the sampled WiFi connection data to a JSON string (same fields as WiFiInfoClass).
+/// </summary>
+/// <returns>The JSON string</returns>
+String TelemetryClass::serializeWiFi()
+{
+	StaticJsonDocument<WIFI_CAPACITY> doc;
+	String json;
+
+	serializeWiFi(doc.to<JsonObject>());
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
+
+/// <summary>
+///  Add the sampled WiFi connection data to a JSON object (the strings are copied).
+/// </summary>
+/// <param name="doc">The JSON object</param>
+void TelemetryClass::serializeWiFi(JsonObject doc)
+{
+	TelemetryData snapshot;
+	read(snapshot);
+
+	doc["SSID"] = snapshot.WiFi.SSID.buffer();
+	doc["PASS"] = snapshot.WiFi.PASS.buffer();
+	doc["Hostname"] = snapshot.WiFi.Hostname.buffer();
+	doc["NetworkID"] = snapshot.WiFi.NetworkID.buffer();
+	doc["Address"] = snapshot.WiFi.Address.buffer();
+	doc["Gateway"] = snapshot.WiFi.Gateway.buffer();
+	doc["Subnet"] = snapshot.WiFi.Subnet.buffer();
+	doc["DNS"] = snapshot.WiFi.DNS.buffer();
+	doc["RSSI"] = snapshot.WiFi.RSSI;
+	doc["BSSID"] = snapshot.WiFi.BSSID.buffer();
+	doc["MAC"] = snapshot.WiFi.MAC.buffer();
+}
+
+/// <summary>
+///  Serialize the history to a compact JSON time series (one array per column, oldest first).
+///  The JSON is written directly to avoid a large document; the buffer is static since all
+///  request handlers run on the async_tcp task.
+/// </summary>
+/// <returns>The JSON string</returns>
+String TelemetryClass::serialize()
+{
+	static TelemetrySample samples[HISTORY_SIZE];
+	int n = read(samples);
+	char text[16];
+	String json;
+
+	json.reserve(96 + n * 24);
+	json += "{\"Interval\":";
+	json += interval * HISTORY_DECIMATION / 1000;
+
+	json += ",\"Time\":[";
+	for (int i = 0; i < n; i++) { snprintf(text, sizeof(text), i ? ",%u" : "%u", samples[i].Time); json += text; }
+
+	json += "],\"RSSI\":[";
+	for (int i = 0; i < n; i++) { snprintf(text, sizeof(text), i ? ",%d" : "%d", samples[i].RSSI); json += text; }
+
+	json += "],\"Clients\":[";
+	for (int i = 0; i < n; i++) { snprintf(text, sizeof(text), i ? ",%u" : "%u", samples[i].Clients); json += text; }
+
+	json += "],\"FreeHeap\":[";
+	for (int i = 0; i < n; i++) { snprintf(text, sizeof(text), i ? ",%u" : "%u", samples[i].FreeHeap); json += text; }
+
+	json += "]}";
+
+	return json;
+}
@@ -0,0 +1,110 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Telemetry.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <WiFi.h>
+#include <ArduinoJson.h>
+
+#include "FixedString.h"
+#include "SnapshotLock.h"
+
+/// <summary>
+/// The sampled WiFi access point data (see ApInfoClass).
+/// </summary>
+struct ApTelemetry
+{
+	FixedString<32> SSID;					// The WiFi Access Point SSID
+	FixedString<64> PASS;					// The WiFi Access Point passphrase
+	FixedString<32> Hostname;				// The WiFi Access Point hostname
+	FixedString<15> NetworkID;				// The WiFi Access Point network ID
+	FixedString<15> Address;				// The WiFi Access Point IP address
+	int Clients;							// The number of clients (max. 4)
+	FixedString<17> MAC;					// The WiFi Access Point MAC address
+};
+
+/// <summary>
+/// The sampled WiFi connection data (see WiFiInfoClass).
+/// </summary>
+struct WiFiTelemetry
+{
+	FixedString<32> SSID;					// The WiFi SSID
+	FixedString<64> PASS;					// The WiFi passphrase
+	FixedString<32> Hostname;				// The WiFi hostname
+	FixedString<15> NetworkID;				// The WiFi network ID
+	FixedString<15> Address;				// The WiFi IP address
+	FixedString<15> Gateway;				// The Gateway address
+	FixedString<15> Subnet;					// The Subnet mask
+	FixedString<15> DNS;					// The domain name server
+	int RSSI;								// The signal strength
+	FixedString<17> BSSID;					// The MAC address of the router
+	FixedString<17> MAC;					// The MAC address
+};
+
+/// <summary>
+/// A complete telemetry snapshot (plain old data).
+/// </summary>
+struct TelemetryData
+{
+	uint32_t Samples;						// The number of samples taken
+	uint32_t Time;							// The sample time (msec since boot)
+	uint32_t FreeHeap;						// The amount of free heap in bytes
+	ApTelemetry Ap;							// The access point data
+	WiFiTelemetry WiFi;						// The WiFi connection data
+};
+
+/// <summary>
+/// A downsampled history entry.
+/// </summary>
+struct TelemetrySample
+{
+	uint32_t Time;							// The sample time (sec since boot)
+	int8_t RSSI;							// The WiFi signal strength (dBm)
+	uint8_t Clients;						// The number of access point clients
+	uint16_t FreeHeap;						// The amount of free heap in kB
+};
+
+/// <summary>
+/// This class runs a low priority task sampling the WiFi and heap data at a fixed interval.
+/// The snapshot and the history are published under a short critical section (see SnapshotLock): the sampler
+/// task takes the sample into a local copy and only copies it in, readers only copy it out.
+/// Request handlers therefore never call the WiFi driver and never wait for the sampler task.
+/// </summary>
+class TelemetryClass
+{
+public:
+	static const uint32_t DEFAULT_INTERVAL = 1000;		// The default sample interval (msec)
+	static const int HISTORY_SIZE = 120;				// The number of history entries
+	static const int HISTORY_DECIMATION = 10;			// The number of samples per history entry
+	static const int AP_CAPACITY = JSON_OBJECT_SIZE(7) + sizeof(ApTelemetry);		// The JSON capacity (copied strings)
+	static const int WIFI_CAPACITY = JSON_OBJECT_SIZE(11) + sizeof(WiFiTelemetry);	// The JSON capacity (copied strings)
+
+private:
+	SnapshotLock lock;									// The lock guarding the snapshot and the history
+	uint32_t interval = DEFAULT_INTERVAL;				// The sample interval (msec)
+	TelemetryData data;									// The current snapshot
+	TelemetrySample history[HISTORY_SIZE];				// The history ring buffer
+	int next = 0;										// The next history index
+	int count = 0;										// The number of history entries
+
+	static void run(void* parameter);					// The sampler task function
+	void sample();										// Takes a single sample
+
+public:
+	TelemetryClass();
+
+	void begin(uint32_t interval = DEFAULT_INTERVAL);	// Starts the sampler task
+	void read(TelemetryData& snapshot);					// Copies the current snapshot
+	int read(TelemetrySample* samples);					// Copies the history (oldest first)
+
+	String serializeAp();								// Return the access point data (JSON)
+	void serializeAp(JsonObject doc);					// Add the access point data to a JSON object
+	String serializeWiFi();								// Return the WiFi connection data (JSON)
+	void serializeWiFi(JsonObject doc);					// Add the WiFi connection data to a JSON object
+	String serialize();									// Return the history (JSON)
+};
@@ -0,0 +1,256 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="TemplateRenderer.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <new>
+#include <rom/crc.h>
+
+#include "TemplateRenderer.h"
+#include "Templates.h"
+
+/// <summary>
+///  Returns the compiled page for a path (or NULL).
+/// </summary>
+const PageTemplate* TemplateRendererClass::find(const char* path)
+{
+	for (int i = 0; i < TEMPLATE_COUNT; ++i)
+	{
+		if (strcmp(TEMPLATES[i].Path, path) == 0)
+		{
+			return &TEMPLATES[i];
+		}
+	}
+
+	return NULL;
+}
+
+/// <summary>
+///  Checks the size and the CRC-32 of the page file once (the result is cached until reboot).
+/// </summary>
+/// <param name="fs">The file system</param>
+/// <param name="index">The template index</param>
+/// <returns>True if the file matches the compiled page</returns>
+bool TemplateRendererClass::verify(fs::FS& fs, int index)
+{
+	static int8_t verified[TEMPLATE_COUNT] = {};
+
+	if (verified[index] == 0)
+	{
+		File file = fs.open(TEMPLATES[index].Path, "r");
+		uint32_t crc = 0;
+		uint8_t buffer[256];
+		size_t len;
+
+		if (!file || (file.size() != TEMPLATES[index].Size))
+		{
+			verified[index] = -1;
+			return false;
+		}
+
+		while ((len = file.read(buffer, sizeof(buffer))) > 0)
+		{
+			crc = crc32_le(crc, buffer, len);
+		}
+
+		file.close();
+		verified[index] = (crc == TEMPLATES[index].CRC) ? 1 : -1;
+
+		if (verified[index] < 0)
+		{
+			Serial.print("Template changed (run tools/templates.py): "); Serial.println(TEMPLATES[index].Path);
+		}
+	}
+
+	return verified[index] > 0;
+}
+
+/// <summary>
+///  Sends a compiled page as a chunked response. If no admission slot or arena block is available
+///  the request is shed (503).
+/// </summary>
+/// <param name="request">The web server request</param>
+/// <param name="fs">The file system</param>
+/// <param name="path">The page file</param>
+/// <param name="render">The placeholder renderer</param>
+/// <returns>False if the page is not compiled or has been changed (nothing has been sent)</returns>
+bool TemplateRendererClass::send(AsyncWebServerRequest* request, fs::FS& fs, const char* path, PlaceholderRenderer render)
+{
+	static_assert(sizeof(State) <= ArenaPoolClass::BLOCK_SIZE, "The rendering state does not fit an arena block");
+	const PageTemplate* page = find(path);
+
+	if ((page == NULL) || !verify(fs, page - TEMPLATES))
+	{
+		return false;
+	}
+
+	RequestArena* arena = pool.acquire();
+
+	if (arena == NULL)
+	{
+		admission.shed(request);
+		return true;
+	}
+
+	if (!admission.open(request))
+	{
+		pool.release(arena);
+		return true;
+	}
+
+	State* state = new (arena->allocate(sizeof(State))) State();
+	state->file = fs.open(path, "r");
+
+	if (!state->file)
+	{
+		state->~State();
+		pool.release(arena);
+		admission.close();
+		return false;
+	}
+
+	state->page = page;
+	state->render = render;
+	state->context.Arena = arena;
+
+	AsyncWebServerResponse* response = request->beginChunkedResponse("text/html",
+		[state](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+			return fill(state, buffer, maxLen);
+		});
+
+	response->addHeader("Cache-Control", "no-cache");
+	request->onDisconnect([this, state, arena]() {
+		state->file.close();
+		state->~State();
+		pool.release(arena);
+		admission.close();
+	});
+	request->send(response);
+
+	return true;
+}
+
+/// <summary>
+///  Fills the next chunk: pending value characters, then static spans read from the file
+///  and the rendered placeholders in between. Returns 0 when the page is complete.
+/// </summary>
+size_t TemplateRendererClass::fill(State* state, uint8_t* buffer, size_t size)
+{
+	size_t written = 0;
+
+	while (written < size)
+	{
+		if (state->pending < state->length)
+		{
+			written += escape(state, buffer + written, size - written);
+
+			if (state->pending < state->length)
+			{
+				break;
+			}
+
+			continue;
+		}
+
+		if (state->segment >= state->page->Count)
+		{
+			break;
+		}
+
+		const TemplateSegment& segment = state->page->Segments[state->segment];
+
+		if (state->offset < segment.Length)
+		{
+			uint32_t position = segment.Offset + state->offset;
+
+			if ((state->position != position) && !state->file.seek(position))
+			{
+				state->segment = state->page->Count;
+				break;
+			}
+
+			size_t len = state->file.read(buffer + written, min((size_t)(segment.Length - state->offset), size - written));
+
+			if (len == 0)
+			{
+				state->segment = state->page->Count;
+				break;
+			}
+
+			state->offset += len;
+			state->position = position + len;
+			written += len;
+			continue;
+		}
+
+		if (segment.Id != Placeholder::None)
+		{
+			const char* name = PLACEHOLDER_NAMES[(int)segment.Id];
+			size_t length = strlen(name);
+
+			// The renderer may return the untruncated length (like snprintf).
+			state->length = min(state->render(segment.Id, state->value, VALUE_SIZE, state->context), VALUE_SIZE - 1);
+			state->pending = 0;
+			state->json = (length > 4) && (strcmp(name + length - 4, "Json") == 0);
+		}
+
+		++state->segment;
+		state->offset = 0;
+	}
+
+	return written;
+}
+
+/// <summary>
+///  Copies the pending value characters (escaped) into the buffer, stops before an escape that does not fit.
+/// </summary>
+size_t TemplateRendererClass::escape(State* state, uint8_t* buffer, size_t size)
+{
+	size_t written = 0;
+
+	while (state->pending < state->length)
+	{
+		char c = state->value[state->pending];
+		const char* text = NULL;
+
+		if (state->json)
+		{
+			// Prevent closing the script element (e.g. "</script>" in an SSID).
+			if (c == '<') text = "\\u003c";
+		}
+		else
+		{
+			switch (c)
+			{
+			case '&': text = "&amp;"; break;
+			case '<': text = "&lt;"; break;
+			case '>': text = "&gt;"; break;
+			case '"': text = "&quot;"; break;
+			}
+		}
+
+		size_t len = (text != NULL) ? strlen(text) : 1;
+
+		if (written + len > size)
+		{
+			break;
+		}
+
+		if (text != NULL)
+		{
+			memcpy(buffer + written, text, len);
+		}
+		else
+		{
+			buffer[written] = (uint8_t)c;
+		}
+
+		written += len;
+		++state->pending;
+	}
+
+	return written;
+}
@@ -0,0 +1,83 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="TemplateRenderer.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <FS.h>
+#include <ESPAsyncWebServer.h>
+
+#include "AdmissionControl.h"
+#include "ArenaPool.h"
+
+enum class Placeholder : uint8_t;
+struct PageTemplate;
+
+/// <summary>
+/// The rendering context of a response: the arena block holding the rendering state (for values
+/// needing memory, e.g. a JSON document) and the data kept by the renderer (NULL until set).
+/// </summary>
+struct RenderContext
+{
+	RequestArena* Arena;					// The arena block of the response
+	void* Data;								// The renderer data (e.g. a snapshot taken once per response)
+};
+
+/// <summary>
+/// Renders a placeholder value (unescaped) into the buffer and returns the length.
+/// </summary>
+typedef size_t (*PlaceholderRenderer)(Placeholder id, char* buffer, size_t size, RenderContext& context);
+
+/// <summary>
+/// This class streams a page compiled by tools/templates.py (see Templates.h) as a chunked response.
+/// The static spans are read from the page file straight into the response buffer, the placeholders
+/// are rendered (and escaped) in between. No scanning for placeholders is done at runtime.
+/// A page changed after compiling (size or CRC mismatch) is not rendered.
+/// The open page file takes an admission slot, the rendering state is kept in a block of the arena pool
+/// (the rest of the block is left to the renderer, see RenderContext).
+/// </summary>
+class TemplateRendererClass
+{
+public:
+	static const size_t VALUE_SIZE = 1024;	// The maximum length of a rendered value
+
+private:
+	/// <summary>
+	/// The rendering state of a response.
+	/// </summary>
+	struct State
+	{
+		File file;							// The page file
+		const PageTemplate* page;			// The compiled page
+		PlaceholderRenderer render;			// The placeholder renderer
+		RenderContext context;				// The rendering context
+		uint16_t segment;					// The current segment
+		uint32_t offset;					// The offset within the current span
+		uint32_t position;					// The file position
+		bool json;							// The value is escaped for a script
+		size_t length;						// The length of the rendered value
+		size_t pending;						// The next value character to send
+		char value[VALUE_SIZE];				// The rendered value
+	};
+
+public:
+	static const size_t CONTEXT_SIZE = ArenaPoolClass::BLOCK_SIZE - sizeof(State);	// The arena memory left to the renderer
+
+private:
+	AdmissionControlClass& admission;		// The admission control (open file responses)
+	ArenaPoolClass& pool;					// The pool holding the rendering states
+
+	static const PageTemplate* find(const char* path);
+	static bool verify(fs::FS& fs, int index);
+	static size_t fill(State* state, uint8_t* buffer, size_t size);
+	static size_t escape(State* state, uint8_t* buffer, size_t size);
+
+public:
+	TemplateRendererClass(AdmissionControlClass& admission, ArenaPoolClass& pool) : admission(admission), pool(pool) {}
+
+	bool send(AsyncWebServerRequest* request, fs::FS& fs, const char* path, PlaceholderRenderer render);
+};
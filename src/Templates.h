@@ -0,0 +1,131 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Templates.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+// Generated by tools/templates.py from data/*.html - do not edit.
+#pragma once
+
+#include <stdint.h>
+
+/// <summary>
+/// The template placeholders (values ending in Json are escaped for a script, all others as HTML text).
+/// </summary>
+enum class Placeholder : uint8_t
+{
+	None,
+	ServerApAddress,
+	ServerWiFiAddress,
+	ServerName,
+	ServerPort,
+	ServerUrl,
+	ApDisplay,
+	ApSSID,
+	ApPASS,
+	ApNetworkID,
+	ApHostname,
+	ApAddress,
+	ApClients,
+	ApMAC,
+	WiFiDisplay,
+	WiFiSSID,
+	WiFiPASS,
+	WiFiNetworkID,
+	WiFiHostname,
+	WiFiAddress,
+	WiFiGateway,
+	WiFiSubnet,
+	WiFiDNS,
+	WiFiBSSID,
+	WiFiMAC,
+	SettingsJson
+};
+
+/// <summary>
+/// A static span of the page file followed by a placeholder (None for the last segment).
+/// </summary>
+struct TemplateSegment
+{
+	uint32_t Offset;						// The offset of the static span
+	uint16_t Length;						// The length of the static span
+	Placeholder Id;							// The placeholder following the span
+};
+
+/// <summary>
+/// A compiled page (the size and CRC-32 detect a page changed after compiling).
+/// </summary>
+struct PageTemplate
+{
+	const char* Path;						// The page file
+	uint32_t Size;							// The page size
+	uint32_t CRC;							// The CRC-32 of the page
+	const TemplateSegment* Segments;		// The segments
+	uint16_t Count;							// The number of segments
+};
+
+static const TemplateSegment CONFIG_HTML_SEGMENTS[] = {
+	{ 0, 2051, Placeholder::ServerApAddress },
+	{ 2070, 63, Placeholder::ServerWiFiAddress },
+	{ 2154, 55, Placeholder::ServerName },
+	{ 2223, 55, Placeholder::ServerPort },
+	{ 2292, 54, Placeholder::ServerUrl },
+	{ 2359, 164, Placeholder::ApDisplay },
+	{ 2536, 72, Placeholder::ApSSID },
+	{ 2618, 46, Placeholder::ApPASS },
+	{ 2674, 51, Placeholder::ApNetworkID },
+	{ 2740, 50, Placeholder::ApHostname },
+	{ 2804, 49, Placeholder::ApAddress },
+	{ 2866, 49, Placeholder::ApClients },
+	{ 2928, 45, Placeholder::ApMAC },
+	{ 2982, 58, Placeholder::WiFiDisplay },
+	{ 3055, 69, Placeholder::WiFiSSID },
+	{ 3136, 48, Placeholder::WiFiPASS },
+	{ 3196, 53, Placeholder::WiFiNetworkID },
+	{ 3266, 52, Placeholder::WiFiHostname },
+	{ 3334, 51, Placeholder::WiFiAddress },
+	{ 3400, 51, Placeholder::WiFiGateway },
+	{ 3466, 50, Placeholder::WiFiSubnet },
+	{ 3530, 47, Placeholder::WiFiDNS },
+	{ 3588, 49, Placeholder::WiFiBSSID },
+	{ 3650, 47, Placeholder::WiFiMAC },
+	{ 3708, 14858, Placeholder::SettingsJson },
+	{ 18582, 8219, Placeholder::None },
+};
+
+static const PageTemplate TEMPLATES[] = {
+	{ "/config.html", 26801, 0xFDEEC7BB, CONFIG_HTML_SEGMENTS, 26 },
+};
+
+static const int TEMPLATE_COUNT = 1;
+
+static const char* const PLACEHOLDER_NAMES[] = {
+	"None",
+	"ServerApAddress",
+	"ServerWiFiAddress",
+	"ServerName",
+	"ServerPort",
+	"ServerUrl",
+	"ApDisplay",
+	"ApSSID",
+	"ApPASS",
+	"ApNetworkID",
+	"ApHostname",
+	"ApAddress",
+	"ApClients",
+	"ApMAC",
+	"WiFiDisplay",
+	"WiFiSSID",
+	"WiFiPASS",
+	"WiFiNetworkID",
+	"WiFiHostname",
+	"WiFiAddress",
+	"WiFiGateway",
+	"WiFiSubnet",
+	"WiFiDNS",
+	"WiFiBSSID",
+	"WiFiMAC",
+	"SettingsJson",
+};
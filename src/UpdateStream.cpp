@@ -0,0 +1,334 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="UpdateStream.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+#include "UpdateStream.h"
+
+/// <summary>
+///  Returns the current time in milliseconds.
+/// </summary>
+uint32_t UpdateStreamClass::now()
+{
+#ifdef ARDUINO
+	return millis();
+#else
+	using namespace std::chrono;
+	return (uint32_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/// <summary>
+///  Parses a hex string into a byte array (the length has to match exactly).
+/// </summary>
+/// <param name="text">The hex string</param>
+/// <param name="bytes">The byte array</param>
+/// <param name="size">The number of bytes</param>
+/// <returns>True if successful</returns>
+bool UpdateStreamClass::parseHex(const char* text, uint8_t* bytes, size_t size)
+{
+	if ((text == nullptr) || (strlen(text) != 2 * size))
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < size; i++)
+	{
+		unsigned int value;
+
+		if (sscanf(text + 2 * i, "%2x", &value) != 1)
+		{
+			return false;
+		}
+
+		bytes[i] = (uint8_t)value;
+	}
+
+	return true;
+}
+
+/// <summary>
+///  Starts a new update. At least one of the digests has to be specified.
+/// </summary>
+/// <param name="writer">The partition writer</param>
+/// <param name="size">The image size</param>
+/// <param name="md5">The expected MD5 (hex, NULL if not specified)</param>
+/// <param name="sha256">The expected SHA-256 (hex, NULL if not specified)</param>
+/// <returns>True if successful</returns>
+bool UpdateStreamClass::begin(PartitionWriter* writer, size_t size, const char* md5, const char* sha256)
+{
+	if (Status == Running)
+	{
+		Error = "Update already running";
+		return false;
+	}
+
+	this->writer = writer;
+	fill = 0;
+	Size = size;
+	Received = 0;
+	Written = 0;
+	Duration = 0;
+	Error = "";
+	Status = Running;
+	start = now();
+
+	mbedtls_md5_init(&md5Context);
+	mbedtls_md5_starts(&md5Context);
+	mbedtls_sha256_init(&sha256Context);
+	mbedtls_sha256_starts(&sha256Context, 0);
+
+	checkMD5 = (md5 != nullptr) && (*md5 != '\0');
+	checkSHA256 = (sha256 != nullptr) && (*sha256 != '\0');
+
+	if (!checkMD5 && !checkSHA256)
+	{
+		return fail("Digest required (X-Update-MD5 or X-Update-SHA256)");
+	}
+
+	if (checkMD5 && !parseHex(md5, this->md5, sizeof(this->md5)))
+	{
+		return fail("Invalid MD5");
+	}
+
+	if (checkSHA256 && !parseHex(sha256, this->sha256, sizeof(this->sha256)))
+	{
+		return fail("Invalid SHA-256");
+	}
+
+	if ((writer == nullptr) || !writer->begin(size))
+	{
+		return fail("Partition not available");
+	}
+
+	return true;
+}
+
+/// <summary>
+///  Streams the next chunk (full blocks are written immediately).
+/// </summary>
+/// <param name="data">The chunk data</param>
+/// <param name="len">The chunk length</param>
+/// <returns>True if successful</returns>
+bool UpdateStreamClass::write(const uint8_t* data, size_t len)
+{
+	if (Status != Running)
+	{
+		return false;
+	}
+
+	if ((Size > 0) && (Received + len > Size))
+	{
+		return fail("Image too large");
+	}
+
+	if (checkMD5) mbedtls_md5_update(&md5Context, data, len);
+	if (checkSHA256) mbedtls_sha256_update(&sha256Context, data, len);
+
+	Received += len;
+
+	while (len > 0)
+	{
+		size_t n = BUFFER_SIZE - fill;
+		if (n > len) n = len;
+
+		memcpy(buffer + fill, data, n);
+		fill += n;
+		data += n;
+		len -= n;
+
+		if ((fill == BUFFER_SIZE) && !flush())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/// <summary>
+///  Writes the buffered data to the partition.
+/// </summary>
+bool UpdateStreamClass::flush()
+{
+	if (fill == 0)
+	{
+		return true;
+	}
+
+	if (!writer->write(buffer, fill))
+	{
+		return fail("Write failed");
+	}
+
+	Written += fill;
+	fill = 0;
+
+	return true;
+}
+
+/// <summary>
+///  Writes the remaining data, verifies the digests and activates the image.
+/// </summary>
+/// <returns>True if successful</returns>
+bool UpdateStreamClass::end()
+{
+	if (Status != Running)
+	{
+		return false;
+	}
+
+	if (!flush())
+	{
+		return false;
+	}
+
+	if ((Size > 0) && (Received != Size))
+	{
+		return fail("Image incomplete");
+	}
+
+	uint8_t digest[32];
+
+	if (checkMD5)
+	{
+		mbedtls_md5_finish(&md5Context, digest);
+
+		if (memcmp(digest, md5, sizeof(md5)) != 0)
+		{
+			return fail("MD5 mismatch");
+		}
+	}
+
+	if (checkSHA256)
+	{
+		mbedtls_sha256_finish(&sha256Context, digest);
+
+		if (memcmp(digest, sha256, sizeof(sha256)) != 0)
+		{
+			return fail("SHA-256 mismatch");
+		}
+	}
+
+	mbedtls_md5_free(&md5Context);
+	mbedtls_sha256_free(&sha256Context);
+
+	if (!writer->end())
+	{
+		return fail("Activation failed");
+	}
+
+	Duration = now() - start;
+	Status = Done;
+
+	return true;
+}
+
+/// <summary>
+///  Discards a running update.
+/// </summary>
+void UpdateStreamClass::abort()
+{
+	if (Status == Running)
+	{
+		fail("Aborted");
+	}
+}
+
+/// <summary>
+///  Aborts the update with an error message.
+/// </summary>
+/// <param name="message">The error message (static string)</param>
+/// <returns>Always false</returns>
+bool UpdateStreamClass::fail(const char* message)
+{
+	if (writer != nullptr)
+	{
+		writer->abort();
+	}
+
+	mbedtls_md5_free(&md5Context);
+	mbedtls_sha256_free(&sha256Context);
+
+	Duration = now() - start;
+	Error = message;
+	Status = Failed;
+
+	return false;
+}
+
+/// <summary>
+///  Returns the achieved write throughput.
+/// </summary>
+/// <returns>The throughput in bytes per second</returns>
+uint32_t UpdateStreamClass::throughput()
+{
+	uint32_t elapsed = (Status == Running) ? now() - start : Duration;
+	return (elapsed > 0) ? (uint32_t)((uint64_t)Written * 1000 / elapsed) : 0;
+}
+
+#ifndef ARDUINO
+/// <summary>
+///  Creates a file backed partition writer.
+/// </summary>
+/// <param name="path">The target file</param>
+FilePartitionWriter::FilePartitionWriter(const char* path)
+{
+	snprintf(this->path, sizeof(this->path), "%s", path);
+	snprintf(temp, sizeof(temp), "%s.new", path);
+}
+
+/// <summary>
+///  Creates the temporary file.
+/// </summary>
+bool FilePartitionWriter::begin(size_t /*size*/)
+{
+	file = fopen(temp, "wb");
+	return file != nullptr;
+}
+
+/// <summary>
+///  Appends a block to the temporary file.
+/// </summary>
+bool FilePartitionWriter::write(const uint8_t* data, size_t len)
+{
+	return fwrite(data, 1, len, (FILE*)file) == len;
+}
+
+/// <summary>
+///  Closes the temporary file and replaces the target file.
+/// </summary>
+bool FilePartitionWriter::end()
+{
+	bool ok = (fclose((FILE*)file) == 0);
+	file = nullptr;
+
+	return ok && (rename(temp, path) == 0);
+}
+
+/// <summary>
+///  Closes and removes the temporary file.
+/// </summary>
+void FilePartitionWriter::abort()
+{
+	if (file != nullptr)
+	{
+		fclose((FILE*)file);
+		file = nullptr;
+	}
+
+	remove(temp);
+}
+#endif
@@ -0,0 +1,100 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="UpdateStream.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <mbedtls/md5.h>
+#include <mbedtls/sha256.h>
+
+/// <summary>
+/// The target of a streamed update (an OTA app partition, the SPIFFS partition or a file on the host).
+/// </summary>
+class PartitionWriter
+{
+public:
+	virtual ~PartitionWriter() {}
+
+	virtual bool begin(size_t size) = 0;						// Prepares (erases) the target for size bytes
+	virtual bool write(const uint8_t* data, size_t len) = 0;	// Writes the next block
+	virtual bool end() = 0;										// Finalizes and activates the written image
+	virtual void abort() = 0;									// Discards the written data
+};
+
+#ifndef ARDUINO
+/// <summary>
+/// A file backed stand-in for a partition (host builds). The image is written to a temporary
+/// file which replaces the target file on end() - the equivalent of switching the boot partition.
+/// </summary>
+class FilePartitionWriter : public PartitionWriter
+{
+private:
+	char path[256];												// The target file
+	char temp[260];												// The temporary file
+	void* file = nullptr;										// The open temporary file (FILE*)
+
+public:
+	FilePartitionWriter(const char* path);
+
+	bool begin(size_t size) override;
+	bool write(const uint8_t* data, size_t len) override;
+	bool end() override;
+	void abort() override;
+};
+#endif
+
+/// <summary>
+/// This class streams an update image chunk by chunk into a partition writer.
+/// The data is collected in a fixed size buffer and written in flash sector sized blocks,
+/// the image is never held in RAM. The MD5 and/or SHA-256 are computed on the fly and
+/// verified before the image is activated.
+/// </summary>
+class UpdateStreamClass
+{
+public:
+	static const size_t BUFFER_SIZE = 4096;						// The write block size (flash sector)
+
+	/// <summary>
+	/// The state of the update stream.
+	/// </summary>
+	enum State { Idle, Running, Done, Failed };
+
+private:
+	PartitionWriter* writer = nullptr;							// The update target
+	uint8_t buffer[BUFFER_SIZE];								// The write buffer
+	size_t fill = 0;											// The number of buffered bytes
+	uint8_t md5[16];											// The expected MD5
+	uint8_t sha256[32];											// The expected SHA-256
+	bool checkMD5 = false;										// Verify the MD5
+	bool checkSHA256 = false;									// Verify the SHA-256
+	mbedtls_md5_context md5Context;								// The running MD5
+	mbedtls_sha256_context sha256Context;						// The running SHA-256
+	uint32_t start = 0;											// The start time (msec)
+
+	bool flush();												// Writes the buffered data
+	bool fail(const char* message);								// Aborts the update with an error
+
+public:
+	State Status = Idle;										// The update state
+	const char* Error = "";										// The error message (if failed)
+	size_t Size = 0;											// The expected image size
+	size_t Received = 0;										// The number of bytes received
+	size_t Written = 0;											// The number of bytes written
+	uint32_t Duration = 0;										// The update duration (msec)
+
+	static bool parseHex(const char* text, uint8_t* bytes, size_t size);	// Parses a hex digest
+
+	bool begin(PartitionWriter* writer, size_t size, const char* md5 = nullptr, const char* sha256 = nullptr);
+	bool write(const uint8_t* data, size_t len);				// Streams the next chunk
+	bool end();													// Verifies and activates the image
+	void abort();												// Discards the update
+
+	uint32_t throughput();										// The write throughput (bytes/sec)
+	static uint32_t now();										// The current time (msec)
+};
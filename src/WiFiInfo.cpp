@@ -22,17 +22,19 @@ WiFiInfoClass::WiFiInfoClass(WiFiClass wifi)
 	wifi_config_t config;
 	esp_wifi_get_config(WIFI_IF_STA, &config);
 
-	SSID = String(reinterpret_cast<const char*>(config.sta.ssid));
-	PASS = String(reinterpret_cast<const char*>(config.sta.password));
-	Hostname = String(wifi.getHostname());
-	NetworkID = wifi.networkID().toString();
-	Address = wifi.localIP().toString();
-	Gateway = wifi.gatewayIP().toString();
-	Subnet = wifi.subnetMask().toString();
-	DNS = wifi.dnsIP().toString();
+	uint8_t mac[6];
+
+	SSID.assign(reinterpret_cast<const char*>(config.sta.ssid));
+	PASS.assign(reinterpret_cast<const char*>(config.sta.password));
+	Hostname.assign(wifi.getHostname());
+	formatAddress(NetworkID, wifi.networkID());
+	formatAddress(Address, wifi.localIP());
+	formatAddress(Gateway, wifi.gatewayIP());
+	formatAddress(Subnet, wifi.subnetMask());
+	formatAddress(DNS, wifi.dnsIP());
 	RSSI = wifi.RSSI();
-	BSSID = wifi.BSSIDstr();
-	MAC = wifi.macAddress();
+	formatMAC(BSSID, wifi.BSSID());
+	formatMAC(MAC, wifi.macAddress(mac));
 }
 
 /// <summary>
@@ -45,17 +47,17 @@ String WiFiInfoClass::serialize()
 	StaticJsonDocument<capacity> settings;
 	String json;
 
-	settings["SSID"] = SSID;
-	settings["PASS"] = PASS;
-	settings["Hostname"] = Hostname;
-	settings["NetworkID"] = NetworkID;
-	settings["Address"] = Address;
-	settings["Gateway"] = Gateway;
-	settings["Subnet"] = Subnet;
-	settings["DNS"] = DNS;
+	settings["SSID"] = SSID.c_str();
+	settings["PASS"] = PASS.c_str();
+	settings["Hostname"] = Hostname.c_str();
+	settings["NetworkID"] = NetworkID.c_str();
+	settings["Address"] = Address.c_str();
+	settings["Gateway"] = Gateway.c_str();
+	settings["Subnet"] = Subnet.c_str();
+	settings["DNS"] = DNS.c_str();
 	settings["RSSI"] = RSSI;
-	settings["BSSID"] = BSSID;
-	settings["MAC"] = MAC;
+	settings["BSSID"] = BSSID.c_str();
+	settings["MAC"] = MAC.c_str();
 
 	serializeJsonPretty(settings, json);
 
@@ -68,15 +70,15 @@ String WiFiInfoClass::serialize()
 void WiFiInfoClass::print()
 {
 	Serial.println("WiFi Connection Info:");
-	Serial.print("    SSID:      "); Serial.println(SSID);
-	Serial.print("    PASS:      "); Serial.println(PASS);
-	Serial.print("    NetworkID: "); Serial.println(NetworkID);
-	Serial.print("    Hostname:  "); Serial.println(Hostname);
-	Serial.print("    Address:   "); Serial.println(Address);
-	Serial.print("    Gateway:   "); Serial.println(Gateway);
-	Serial.print("    Subnet:    "); Serial.println(Subnet);
-	Serial.print("    DNS:       "); Serial.println(DNS);
+	Serial.print("    SSID:      "); Serial.println(SSID.c_str());
+	Serial.print("    PASS:      "); Serial.println(PASS.c_str());
+	Serial.print("    NetworkID: "); Serial.println(NetworkID.c_str());
+	Serial.print("    Hostname:  "); Serial.println(Hostname.c_str());
+	Serial.print("    Address:   "); Serial.println(Address.c_str());
+	Serial.print("    Gateway:   "); Serial.println(Gateway.c_str());
+	Serial.print("    Subnet:    "); Serial.println(Subnet.c_str());
+	Serial.print("    DNS:       "); Serial.println(DNS.c_str());
 	Serial.print("    RSSI(dBm): "); Serial.println(RSSI);
-	Serial.print("    BSSID:     "); Serial.println(BSSID);
-	Serial.print("    MAC:       "); Serial.println(MAC);
+	Serial.print("    BSSID:     "); Serial.println(BSSID.c_str());
+	Serial.print("    MAC:       "); Serial.println(MAC.c_str());
 }
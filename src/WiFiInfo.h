@@ -10,6 +10,8 @@
 
 #include <WiFi.h>
 
+#include "FixedString.h"
+
 /// <summary>
 /// This class holds the actual WiFi connection data.
 /// </summary>
@@ -18,17 +20,17 @@ class WiFiInfoClass
 public:
 	WiFiInfoClass(WiFiClass wifi);
 
-	String SSID;							// The WiFi SSID
-	String PASS;							// The WiFi passphrase
-	String Hostname;						// The WiFi hostname
-	String NetworkID;						// The WiFi network ID
-	String Address;							// The WiFi IP address
-	String Gateway;							// The Gateway address
-	String Subnet;							// The Subnet mask
-	String DNS;								// The domain name server
+	FixedString<32> SSID;					// The WiFi SSID
+	FixedString<64> PASS;					// The WiFi passphrase
+	FixedString<32> Hostname;				// The WiFi hostname
+	FixedString<15> NetworkID;				// The WiFi network ID
+	FixedString<15> Address;				// The WiFi IP address
+	FixedString<15> Gateway;				// The Gateway address
+	FixedString<15> Subnet;					// The Subnet mask
+	FixedString<15> DNS;					// The domain name server
 	int RSSI;								// The signal strength
-	String BSSID;							// The MAC address of the router
-	String MAC;								// The MAC address
+	FixedString<17> BSSID;					// The MAC address of the router
+	FixedString<17> MAC;					// The MAC address
 
 	String serialize();						// Return a string serialization (JSON)
 	void print();							// Prints all fields on the serial line
@@ -0,0 +1,218 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="WiFiNetworks.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+
+#include "SettingsBase.h"
+#include "WiFiNetworks.h"
+
+/// <summary>
+///  Initializes the networks from the non volatile storage (single blob read).
+///  An invalid blob leaves the list empty.
+/// </summary>
+void WiFiNetworksClass::init()
+{
+	uint8_t buffer[BLOB_SIZE];
+	SettingsBlobHeader header;
+
+	preferences.begin(NAMESPACE, false);
+	size_t length = preferences.getBytes(KEY_BLOB, buffer, sizeof(buffer));
+	preferences.end();
+
+	lock.lock();
+	Count = 0;
+	lock.unlock();
+
+	if (length < sizeof(header))
+	{
+		return;
+	}
+
+	memcpy(&header, buffer, sizeof(header));
+	uint32_t crc = header.CRC;
+	header.CRC = 0;
+	memcpy(buffer, &header, sizeof(header));
+
+	if ((header.Version != VERSION) || (header.Count > SIZE) ||
+		(header.Length != length - sizeof(header)) || (settingsCrc32(buffer, length) != crc))
+	{
+		return;
+	}
+
+	const uint8_t* p = buffer + sizeof(header);
+	const uint8_t* end = buffer + length;
+	WiFiNetwork networks[SIZE];
+	int count = 0;
+
+	for (int i = 0; i < header.Count; ++i)
+	{
+		WiFiNetwork& network = networks[i];
+
+		if ((p >= end) || (*p > network.SSID.capacity()) || (p + 1 + *p >= end)) break;
+		network.SSID.assign((const char*)(p + 1), *p);
+		p += 1 + *p;
+
+		if ((*p > network.PASS.capacity()) || (p + 1 + *p >= end)) break;
+		network.PASS.assign((const char*)(p + 1), *p);
+		p += 1 + *p;
+
+		network.Priority = *p++;
+		count = i + 1;
+	}
+
+	lock.lock();
+	memcpy(Networks, networks, count * sizeof(WiFiNetwork));
+	Count = count;
+	lock.unlock();
+
+	if (count == header.Count)
+	{
+		Size = length;
+	}
+}
+
+/// <summary>
+///  Saves the networks to the non volatile storage (single blob write).
+/// </summary>
+void WiFiNetworksClass::save()
+{
+	uint8_t buffer[BLOB_SIZE];
+	uint8_t* p = buffer + sizeof(SettingsBlobHeader);
+
+	for (int i = 0; i < Count; ++i)
+	{
+		uint8_t length = (uint8_t)Networks[i].SSID.length();
+		*p++ = length;
+		memcpy(p, Networks[i].SSID.c_str(), length);
+		p += length;
+
+		length = (uint8_t)Networks[i].PASS.length();
+		*p++ = length;
+		memcpy(p, Networks[i].PASS.c_str(), length);
+		p += length;
+
+		*p++ = Networks[i].Priority;
+	}
+
+	SettingsBlobHeader header;
+	header.CRC = 0;
+	header.Length = (uint16_t)(p - buffer - sizeof(SettingsBlobHeader));
+	header.Version = VERSION;
+	header.Count = (uint8_t)Count;
+	memcpy(buffer, &header, sizeof(header));
+	header.CRC = settingsCrc32(buffer, p - buffer);
+	memcpy(buffer, &header, sizeof(header));
+
+	preferences.begin(NAMESPACE, false);
+	preferences.putBytes(KEY_BLOB, buffer, p - buffer);
+	preferences.end();
+
+	Size = p - buffer;
+}
+
+/// <summary>
+///  Clears the networks and the non volatile storage.
+/// </summary>
+void WiFiNetworksClass::clear()
+{
+	lock.lock();
+	Count = 0;
+	lock.unlock();
+
+	Size = 0;
+
+	preferences.begin(NAMESPACE, false);
+	preferences.remove(KEY_BLOB);
+	preferences.end();
+}
+
+/// <summary>
+///  Replaces the networks by a JSON array of objects (SSID, PASS, Priority).
+///  Entries without SSID are skipped, texts are truncated, excess entries are ignored.
+/// </summary>
+/// <param name="doc">The JSON array</param>
+/// <returns>True if successful</returns>
+bool WiFiNetworksClass::deserialize(JsonArray doc)
+{
+	if (doc.isNull())
+	{
+		return false;
+	}
+
+	WiFiNetwork networks[SIZE];
+	int count = 0;
+
+	for (JsonObject entry : doc)
+	{
+		const char* ssid = entry["SSID"] | "";
+
+		if ((ssid[0] == '\0') || (count == SIZE))
+		{
+			continue;
+		}
+
+		WiFiNetwork& network = networks[count++];
+		network.SSID = ssid;
+		network.PASS = entry["PASS"] | "";
+		network.Priority = (uint8_t)constrain(entry["Priority"] | 0, 0, 255);
+	}
+
+	lock.lock();
+	memcpy(Networks, networks, count * sizeof(WiFiNetwork));
+	Count = count;
+	lock.unlock();
+
+	return true;
+}
+
+/// <summary>
+///  Adds the networks to a JSON array (the passphrases are not included). The SSIDs and priorities
+///  are copied under the lock (any task).
+/// </summary>
+/// <param name="doc">The JSON array</param>
+void WiFiNetworksClass::serialize(JsonArray doc)
+{
+	FixedString<WiFiSettingsClass::MAX_SSID_LEN> ssid[SIZE];
+	uint8_t priority[SIZE];
+
+	lock.lock();
+	int count = Count;
+
+	for (int i = 0; i < count; ++i)
+	{
+		ssid[i] = Networks[i].SSID;
+		priority[i] = Networks[i].Priority;
+	}
+
+	lock.unlock();
+
+	for (int i = 0; i < count; ++i)
+	{
+		JsonObject entry = doc.createNestedObject();
+
+		entry["SSID"] = ssid[i].buffer();
+		entry["Priority"] = priority[i];
+	}
+}
+
+/// <summary>
+///  Serialize the WiFiNetworksClass instance data to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String WiFiNetworksClass::serialize()
+{
+	StaticJsonDocument<CAPACITY> doc;
+	String json;
+
+	serialize(doc.to<JsonArray>());
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
@@ -0,0 +1,63 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="WiFiNetworks.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Preferences.h>
+#include <ArduinoJson.h>
+
+#include "WiFiSettings.h"
+#include "SnapshotLock.h"
+
+/// <summary>
+/// The credentials of a WiFi network (trivially copyable).
+/// </summary>
+struct WiFiNetwork
+{
+	FixedString<WiFiSettingsClass::MAX_SSID_LEN> SSID;	// The WiFi SSID
+	FixedString<WiFiSettingsClass::MAX_PASS_LEN> PASS;	// The WiFi passphrase (empty for open networks)
+	uint8_t Priority;									// The priority (higher first, equal priorities ranked by RSSI)
+};
+
+/// <summary>
+/// This class holds an ordered list of additional WiFi networks (besides the WiFiSettings network).
+/// The list is stored as a single NVS blob: header (CRC, version, count) followed by the networks,
+/// each as length prefixed SSID and passphrase and the priority (unused bytes are not stored).
+/// The list is changed by the main task only (see CommandType::ApplyNetworks), under a lock so that
+/// the handlers can copy it (see serialize()).
+/// </summary>
+class WiFiNetworksClass
+{
+public:
+	static const uint8_t VERSION = 1;		// The blob schema version
+	static const int SIZE = 5;				// The maximum number of networks
+	static const int CAPACITY = JSON_ARRAY_SIZE(SIZE) + SIZE * JSON_OBJECT_SIZE(3) +	// The JSON document capacity
+		SIZE * (sizeof("SSID") + sizeof("PASS") + sizeof("Priority") + WiFiSettingsClass::MAX_SSID_LEN + WiFiSettingsClass::MAX_PASS_LEN + 2);
+
+private:
+	static const int BLOB_SIZE = sizeof(SettingsBlobHeader) + SIZE * (3 + WiFiSettingsClass::MAX_SSID_LEN + WiFiSettingsClass::MAX_PASS_LEN);	// The maximum blob size
+
+	const char* NAMESPACE = "Networks";		// The namspace used in preferences
+	const char* KEY_BLOB = "Blob";			// The preference key for the blob
+
+	Preferences preferences;				// The ESP32 preferences instance
+	SnapshotLock lock;						// Guards the networks read by the handlers
+
+public:
+	WiFiNetwork Networks[SIZE];				// The networks (in the order given)
+	int Count = 0;							// The number of networks
+	size_t Size = 0;						// The blob size (bytes)
+
+	void init();							// Initializes the networks from storage
+	void save();							// Saves the networks to storage
+	void clear();							// Clears the networks and the storage
+
+	bool deserialize(JsonArray doc);		// Replaces the networks (SSID, PASS, Priority)
+	void serialize(JsonArray doc);			// Adds the networks to a JSON array (without passphrases)
+	String serialize();						// Return a string serialization (JSON)
+};
@@ -0,0 +1,323 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="WiFiSelector.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+#include <WiFi.h>
+
+#include "WiFiSelector.h"
+
+/// <summary>
+///  Sets the known networks and the connector.
+/// </summary>
+/// <param name="settings">The primary network settings</param>
+/// <param name="networks">The additional networks</param>
+/// <param name="connector">Starts a connection to a network</param>
+void WiFiSelectorClass::begin(WiFiSettingsClass* settings, WiFiNetworksClass* networks, Connector connector)
+{
+	this->settings = settings;
+	this->networks = networks;
+	this->connector = connector;
+}
+
+/// <summary>
+///  Starts the selection: the station is disconnected and the known networks are collected.
+///  The scan is only started if there are additional networks.
+/// </summary>
+/// <returns>True if the selection has been started</returns>
+bool WiFiSelectorClass::start()
+{
+	unsigned long now = millis();
+
+	primary.SSID = settings->SSID;
+	primary.PASS = settings->PASS;
+	primary.Priority = PRIMARY_PRIORITY;
+
+	count = 0;
+	current = 0;
+
+	if (primary.SSID != "")
+	{
+		candidates[count++] = { -1, 0, primary.Priority, false };
+	}
+
+	for (int i = 0; i < networks->Count; ++i)
+	{
+		candidates[count++] = { (int8_t)i, 0, networks->Networks[i].Priority, false };
+	}
+
+	lock.lock();
+	SSID = "";
+	RSSI = 0;
+	Priority = 0;
+	ScanTime = 0;
+	ConnectTime = 0;
+	Scanned = 0;
+	Found = 0;
+	Tried = 0;
+	started = now;
+
+	if (count == 0)
+	{
+		Status = Idle;
+		lock.unlock();
+		return false;
+	}
+
+	lock.unlock();
+
+	WiFi.disconnect(false);
+	WiFi.scanDelete();
+
+	if ((networks->Count > 0) && (WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING))
+	{
+		lock.lock();
+		Status = Scanning;
+		lock.unlock();
+		return true;
+	}
+
+	rank(0);
+	next(now);
+
+	return true;
+}
+
+/// <summary>
+///  Advances the selection: waits for the scan results, then tries the ranked networks in turn.
+/// </summary>
+/// <returns>True if the selection has finished (see Status)</returns>
+bool WiFiSelectorClass::update()
+{
+	unsigned long now = millis();
+
+	switch (Status)
+	{
+	case Scanning:
+	{
+		int found = WiFi.scanComplete();
+
+		if ((found == WIFI_SCAN_RUNNING) && (now - started < SCAN_TIMEOUT))
+		{
+			return false;
+		}
+
+		lock.lock();
+		ScanTime = now - started;
+		lock.unlock();
+
+		rank((found > 0) ? found : 0);
+		WiFi.scanDelete();
+
+		return next(now);
+	}
+
+	case Connecting:
+		if (WiFi.status() == WL_CONNECTED)
+		{
+			lock.lock();
+			ConnectTime = now - started;
+			++Selections;
+			Status = Connected;
+			lock.unlock();
+			return true;
+		}
+
+		if (now - attempt > CONNECT_TIMEOUT)
+		{
+			WiFi.disconnect(false);
+			return next(now);
+		}
+
+		return false;
+
+	default:
+		return true;
+	}
+}
+
+/// <summary>
+///  Ranks the candidates: the networks seen by the scan are ordered by priority, then by RSSI
+///  (all candidates are kept in priority order if none has been seen).
+/// </summary>
+/// <param name="found">The number of scanned networks</param>
+void WiFiSelectorClass::rank(int found)
+{
+	int seen = 0;
+
+	for (int i = 0; i < found; ++i)
+	{
+		String ssid = WiFi.SSID(i);
+		int rssi = WiFi.RSSI(i);
+
+		for (int j = 0; j < count; ++j)
+		{
+			Candidate& candidate = candidates[j];
+
+			if ((network(candidate).SSID == ssid) && (!candidate.Found || (rssi > candidate.RSSI)))
+			{
+				candidate.Found = true;
+				candidate.RSSI = (int8_t)rssi;
+			}
+		}
+	}
+
+	// Keep the candidates seen by the scan.
+	for (int i = 0; i < count; ++i)
+	{
+		if (candidates[i].Found)
+		{
+			candidates[seen++] = candidates[i];
+		}
+	}
+
+	if (seen > 0)
+	{
+		count = seen;
+	}
+
+	lock.lock();
+	Scanned = found;
+	Found = seen;
+	lock.unlock();
+
+	// Insertion sort (stable, keeps the configured order of equal candidates).
+	for (int i = 1; i < count; ++i)
+	{
+		Candidate candidate = candidates[i];
+		int j = i;
+
+		while ((j > 0) && ((candidates[j - 1].Priority < candidate.Priority) ||
+			((candidates[j - 1].Priority == candidate.Priority) && (candidates[j - 1].RSSI < candidate.RSSI))))
+		{
+			candidates[j] = candidates[j - 1];
+			--j;
+		}
+
+		candidates[j] = candidate;
+	}
+}
+
+/// <summary>
+///  Tries the next candidate (candidates rejected by the connector are skipped).
+/// </summary>
+/// <param name="now">The current time (msec)</param>
+/// <returns>True if all candidates have failed</returns>
+bool WiFiSelectorClass::next(unsigned long now)
+{
+	while (current < count)
+	{
+		const Candidate& candidate = candidates[current++];
+		const WiFiNetwork& selected = network(candidate);
+
+		lock.lock();
+		SSID = selected.SSID;
+		RSSI = candidate.RSSI;
+		Priority = candidate.Priority;
+		lock.unlock();
+
+		if (connector(selected, candidate.Index < 0))
+		{
+			lock.lock();
+			++Tried;
+			Status = Connecting;
+			lock.unlock();
+			attempt = now;
+			return false;
+		}
+	}
+
+	lock.lock();
+	++Failures;
+	Status = Failed;
+	lock.unlock();
+
+	return true;
+}
+
+/// <summary>
+///  Returns the network of a candidate.
+/// </summary>
+const WiFiNetwork& WiFiSelectorClass::network(const Candidate& candidate)
+{
+	return (candidate.Index < 0) ? primary : networks->Networks[candidate.Index];
+}
+
+/// <summary>
+///  Returns true while scanning or connecting.
+/// </summary>
+bool WiFiSelectorClass::running()
+{
+	return (Status == Scanning) || (Status == Connecting);
+}
+
+/// <summary>
+///  Returns the name of a selection state.
+/// </summary>
+/// <param name="state">The state</param>
+/// <returns>The state name</returns>
+const char* WiFiSelectorClass::name(State state)
+{
+	switch (state)
+	{
+	case Scanning: return "Scanning";
+	case Connecting: return "Connecting";
+	case Connected: return "Connected";
+	case Failed: return "Failed";
+	default: return "Idle";
+	}
+}
+
+/// <summary>
+///  Adds the selection data to a JSON object.
+/// </summary>
+/// <param name="doc">The JSON object</param>
+void WiFiSelectorClass::serialize(JsonObject doc)
+{
+	lock.lock();
+	State status = Status;
+	FixedString<WiFiSettingsClass::MAX_SSID_LEN> ssid = SSID;
+	int rssi = RSSI;
+	int priority = Priority;
+	unsigned long scanTime = ScanTime;
+	unsigned long connectTime = ConnectTime;
+	int scanned = Scanned;
+	int found = Found;
+	int tried = Tried;
+	uint32_t selections = Selections;
+	uint32_t failures = Failures;
+	lock.unlock();
+
+	doc["Status"] = name(status);
+	doc["SSID"] = ssid.buffer();
+	doc["RSSI"] = rssi;
+	doc["Priority"] = priority;
+	doc["ScanTime"] = scanTime;
+	doc["ConnectTime"] = connectTime;
+	doc["Scanned"] = scanned;
+	doc["Found"] = found;
+	doc["Tried"] = tried;
+	doc["Selections"] = selections;
+	doc["Failures"] = failures;
+}
+
+/// <summary>
+///  Serialize the WiFiSelectorClass instance data to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String WiFiSelectorClass::serialize()
+{
+	StaticJsonDocument<CAPACITY> doc;
+	String json;
+
+	serialize(doc.to<JsonObject>());
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
@@ -0,0 +1,101 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="WiFiSelector.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "WiFiSettings.h"
+#include "WiFiNetworks.h"
+#include "SnapshotLock.h"
+
+/// <summary>
+/// This class selects the WiFi network to connect to. The known networks are the WiFiSettings network
+/// (the primary network, ranked with the highest priority) and the WiFiNetworks list. A single async scan
+/// finds the networks in range, which are tried by priority and signal strength (RSSI) with a timeout per
+/// network. If none of them is found (hidden SSIDs) all known networks are tried. Without additional
+/// networks the scan is skipped. The selection is advanced by the main task, the connection is started by
+/// the connector (see beginWiFi). The results are written under a lock and copied by the handlers (see /wifi).
+/// </summary>
+class WiFiSelectorClass
+{
+public:
+	static const unsigned long SCAN_TIMEOUT = 10000;		// The maximum time of the scan (msec)
+	static const unsigned long CONNECT_TIMEOUT = 10000;		// The maximum time per network (msec)
+	static const uint8_t PRIMARY_PRIORITY = 255;			// The priority of the WiFiSettings network
+	static const int SIZE = WiFiNetworksClass::SIZE + 1;	// The maximum number of candidates
+	static const int CAPACITY = JSON_OBJECT_SIZE(11) + WiFiSettingsClass::MAX_SSID_LEN + 1;	// The JSON document capacity
+
+	/// <summary>
+	/// The selection states.
+	/// </summary>
+	enum State
+	{
+		Idle,									// No network configured (or not started)
+		Scanning,								// Waiting for the scan results
+		Connecting,								// Trying a network
+		Connected,								// Connected to the selected network
+		Failed									// No network could be connected
+	};
+
+	/// <summary>
+	/// Starts connecting to a network (returns false if the network cannot be used).
+	/// </summary>
+	typedef bool (*Connector)(const WiFiNetwork& network, bool primary);
+
+private:
+	/// <summary>
+	/// A known network (index into the networks list, -1 for the primary network).
+	/// </summary>
+	struct Candidate
+	{
+		int8_t Index;							// The network index (-1 = primary)
+		int8_t RSSI;							// The best signal strength seen (dBm)
+		uint8_t Priority;						// The priority
+		bool Found;								// True if seen by the scan
+	};
+
+	SnapshotLock lock;							// Guards the results read by the handlers
+	WiFiSettingsClass* settings = NULL;			// The primary network settings
+	WiFiNetworksClass* networks = NULL;			// The additional networks
+	Connector connector = NULL;					// Starts a connection
+	WiFiNetwork primary;						// The primary network (copied at start)
+	Candidate candidates[SIZE];					// The ranked candidates
+	int count = 0;								// The number of candidates
+	int current = 0;							// The next candidate to try
+	unsigned long started = 0;					// The start of the selection (msec)
+	unsigned long attempt = 0;					// The start of the current attempt (msec)
+
+	void rank(int found);						// Ranks the candidates using the scan results
+	bool next(unsigned long now);				// Tries the next candidate
+	const WiFiNetwork& network(const Candidate& candidate);	// Returns the network of a candidate
+
+public:
+	State Status = Idle;						// The current state
+	FixedString<WiFiSettingsClass::MAX_SSID_LEN> SSID;	// The selected (or tried) network
+	int RSSI = 0;								// The signal strength of the selected network (dBm, 0 if not scanned)
+	int Priority = 0;							// The priority of the selected network
+	unsigned long ScanTime = 0;					// The duration of the scan (msec)
+	unsigned long ConnectTime = 0;				// The time from start to connected (msec, including the scan)
+	int Scanned = 0;							// The number of networks seen by the scan
+	int Found = 0;								// The number of known networks seen by the scan
+	int Tried = 0;								// The number of networks tried
+	uint32_t Selections = 0;					// The number of successful selections
+	uint32_t Failures = 0;						// The number of failed selections
+
+	void begin(WiFiSettingsClass* settings, WiFiNetworksClass* networks, Connector connector);
+	bool start();								// Starts the selection (false if no network is configured)
+	bool update();								// Advances the selection (true when finished)
+	bool running();								// True while scanning or connecting
+
+	static const char* name(State state);		// Returns the name of the state
+
+	void serialize(JsonObject doc);				// Adds the selection data to a JSON object
+	String serialize();							// Return a string serialization (JSON)
+};
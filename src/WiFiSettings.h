@@ -8,51 +8,48 @@
 // --------------------------------------------------------------------------------------------------------------------
 #pragma once
 
-#include <Preferences.h>
+#include "SettingsBase.h"
 
 /// <summary>
 /// This class holds the WiFi connection configuration data.
 /// </summary>
-class WiFiSettingsClass
+class WiFiSettingsClass : public SettingsBaseClass<WiFiSettingsClass>
 {
-private:
-	const char* NAMESPACE = "WiFi";				// The namspace used in preferences
-	const char* KEY_SSID = "SSID";				// The preference key for the SSID field
-	const char* KEY_PASS = "PASS";				// The preference key for the passphrase field
-	const char* KEY_HOSTNAME = "Hostname";		// The preference key for the Hostname field
-	const char* KEY_DHCP = "DHCP";				// The preference key for the DHCP field
-	const char* KEY_ADDRESS = "Address";		// The preference key for the Address field
-	const char* KEY_GATEWAY = "Gateway";		// The preference key for the Gateway field
-	const char* KEY_SUBNET = "Subnet";			// The preference key for the SubnetMask field
-	const char* KEY_DNS1 = "DNS1";				// The preference key for the DNS1 field
-	const char* KEY_DNS2 = "DNS2";				// The preference key for the DNS2 field
-
-	const char* WIFI_HOSTNAME = "knoblomat";	// The default access point hostname
-	const char* SUBNET_MASK = "255.255.255.0";	// The default network mask
-
-	const int MAX_SSID_LEN = 32;				// The maximum length for the SSID
-	const int MAX_PASS_LEN = 64;				// The maximum length for the PASS
-	const int MAX_HOSTNAME_LEN = 32;			// The maximum length for the hostname
-	const int MAX_IPADDRESS_LEN = 15;			// The maximum length for an IP address
+public:
+	static constexpr const char* NAMESPACE = "WiFi";			// The namspace used in preferences
+	static const uint8_t VERSION = 1;				// The blob schema version
+	static constexpr const char* WIFI_HOSTNAME = "knoblomat";	// The default access point hostname
+	static constexpr const char* SUBNET_MASK = "255.255.255.0";	// The default network mask
 
-	Preferences preferences;					// The EPS32 preferences instance
+	static const int MAX_SSID_LEN = 32;				// The maximum length for the SSID
+	static const int MAX_PASS_LEN = 64;				// The maximum length for the PASS
+	static const int MAX_HOSTNAME_LEN = 32;			// The maximum length for the hostname
+	static const int MAX_IPADDRESS_LEN = 15;		// The maximum length for an IP address
 
-public:
 	WiFiSettingsClass();
 
-	String SSID;								// The WiFi SSID
-	String PASS;								// The WiFi Passphrase
-	String Hostname;							// The WiFi Hostname
+	FixedString<MAX_SSID_LEN> SSID;				// The WiFi SSID
+	FixedString<MAX_PASS_LEN> PASS;				// The WiFi Passphrase
+	FixedString<MAX_HOSTNAME_LEN> Hostname;		// The WiFi Hostname
 	bool DHCP;									// The WiFi DHCP mode (default: true)
-	String Address;								// The static Address
-	String Gateway;								// The Gateway address
-	String Subnet;								// The SubnetMask
-	String DNS1;								// The primary domain name server
-	String DNS2;								// The secondary domain name server
-
-	bool deserialize(String settings);			// Read a JSON string and updates the fields.
-	String serialize();							// Return a string serialization (JSON)
-	void clear();								// Clears the persistent storage
-	void save();								// Save the fields to storage
-	void init();								// Initializes the fields from storage
+	FixedString<MAX_IPADDRESS_LEN> Address;		// The static Address
+	FixedString<MAX_IPADDRESS_LEN> Gateway;		// The Gateway address
+	FixedString<MAX_IPADDRESS_LEN> Subnet;		// The SubnetMask
+	FixedString<MAX_IPADDRESS_LEN> DNS1;		// The primary domain name server
+	FixedString<MAX_IPADDRESS_LEN> DNS2;		// The secondary domain name server
+
+	// The field descriptors (JSON and preference keys, limits and defaults).
+	static constexpr FieldDescriptor<WiFiSettingsClass> FIELDS[] = {
+		textField<WiFiSettingsClass, MAX_SSID_LEN, &WiFiSettingsClass::SSID>("SSID", ""),
+		textField<WiFiSettingsClass, MAX_PASS_LEN, &WiFiSettingsClass::PASS>("PASS", ""),
+		textField<WiFiSettingsClass, MAX_HOSTNAME_LEN, &WiFiSettingsClass::Hostname>("Hostname", WIFI_HOSTNAME),
+		flagField("DHCP", &WiFiSettingsClass::DHCP, true),
+		textField<WiFiSettingsClass, MAX_IPADDRESS_LEN, &WiFiSettingsClass::Address>("Address", ""),
+		textField<WiFiSettingsClass, MAX_IPADDRESS_LEN, &WiFiSettingsClass::Gateway>("Gateway", ""),
+		textField<WiFiSettingsClass, MAX_IPADDRESS_LEN, &WiFiSettingsClass::Subnet>("Subnet", SUBNET_MASK),
+		textField<WiFiSettingsClass, MAX_IPADDRESS_LEN, &WiFiSettingsClass::DNS1>("DNS1", ""),
+		textField<WiFiSettingsClass, MAX_IPADDRESS_LEN, &WiFiSettingsClass::DNS2>("DNS2", ""),
+	};
+
+	static constexpr int CAPACITY = fieldCapacity(FIELDS);	// The JSON document capacity
 };
@@ -0,0 +1,256 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="WiFiSupervisor.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#include <String.h>
+#include <ArduinoJson.hpp>
+#include <ArduinoJson.h>
+#include <esp_system.h>
+
+#include "WiFiSupervisor.h"
+
+/// <summary>
+///  Initializes the pending events.
+/// </summary>
+WiFiSupervisorClass::WiFiSupervisorClass() : events(0)
+{
+}
+
+/// <summary>
+///  Starts supervising a connection being established (at boot or after new settings).
+///  A reconfiguration is not counted as an outage.
+/// </summary>
+/// <param name="enabled">True if a WiFi network is configured</param>
+/// <param name="budget">The failure budget (0 = never restart)</param>
+void WiFiSupervisorClass::begin(bool enabled, int budget)
+{
+	events.store(0);
+
+	lock.lock();
+	Budget = budget;
+	Failures = 0;
+	Delay = 0;
+	outage = 0;
+	attempt = millis();
+	Status = enabled ? Connecting : Idle;
+	lock.unlock();
+}
+
+/// <summary>
+///  Flags a disconnect event (called by the WiFi event task).
+/// </summary>
+void WiFiSupervisorClass::disconnected()
+{
+	events.fetch_or(EVENT_DISCONNECTED);
+}
+
+/// <summary>
+///  Flags a lost IP event (called by the WiFi event task).
+/// </summary>
+void WiFiSupervisorClass::lostIP()
+{
+	events.fetch_or(EVENT_LOST_IP);
+}
+
+/// <summary>
+///  Advances the state machine. A connection is lost on a disconnect or lost IP event (or if the
+///  station is no longer connected), an attempt fails if no IP address is assigned in time.
+///  The state is changed under the lock (nothing blocks), the handlers copy it (see serialize()).
+/// </summary>
+/// <param name="connected">True if the station is connected and has an IP address</param>
+/// <returns>The action to be performed</returns>
+WiFiSupervisorClass::Action WiFiSupervisorClass::update(bool connected)
+{
+	uint8_t pending = events.exchange(0);
+	unsigned long now = millis();
+	Action action = None;
+
+	lock.lock();
+
+	if (pending & EVENT_DISCONNECTED) ++Disconnects;
+	if (pending & EVENT_LOST_IP) ++LostIPs;
+
+	switch (Status)
+	{
+	case Idle:
+		if (connected)
+		{
+			Status = Connected;
+		}
+
+		break;
+
+	case Connected:
+		if (!connected || (pending != 0))
+		{
+			lost(now);
+		}
+
+		break;
+
+	case Waiting:
+		if (connected)
+		{
+			restored(now);
+		}
+		else if ((long)(now - next) >= 0)
+		{
+			++Attempts;
+			attempt = now;
+			Status = Connecting;
+			action = Reconnect;
+		}
+
+		break;
+
+	case Connecting:
+		if (connected)
+		{
+			restored(now);
+		}
+		else if (now - attempt > CONNECT_TIMEOUT)
+		{
+			++Failures;
+
+			// Only a lost connection is escalated (a restart does not help an unreachable network).
+			if ((Budget > 0) && (Failures >= Budget) && (outage != 0))
+			{
+				Status = Idle;
+				action = Restart;
+				break;
+			}
+
+			Delay = backoff(Failures);
+			next = now + Delay;
+			Status = Waiting;
+		}
+
+		break;
+	}
+
+	lock.unlock();
+
+	return action;
+}
+
+/// <summary>
+///  Starts an outage, the first attempt follows after the base delay (jittered).
+/// </summary>
+/// <param name="now">The current time (msec)</param>
+void WiFiSupervisorClass::lost(unsigned long now)
+{
+	++Outages;
+	outage = now;
+	Failures = 0;
+	Delay = backoff(0);
+	next = now + Delay;
+	Status = Waiting;
+}
+
+/// <summary>
+///  Ends an outage (or a connection being established) and updates the outage statistics.
+/// </summary>
+/// <param name="now">The current time (msec)</param>
+void WiFiSupervisorClass::restored(unsigned long now)
+{
+	if (outage != 0)
+	{
+		LastOutage = now - outage;
+		TotalOutage += LastOutage;
+		if (LastOutage > LongestOutage) LongestOutage = LastOutage;
+		++Reconnects;
+		outage = 0;
+	}
+
+	Failures = 0;
+	Delay = 0;
+	Status = Connected;
+}
+
+/// <summary>
+///  Returns the delay before the next attempt: the base delay doubled per failure (up to the maximum),
+///  randomized between half and the full delay so that devices do not reconnect in lockstep.
+/// </summary>
+/// <param name="failures">The number of failed attempts in a row</param>
+/// <returns>The delay (msec)</returns>
+unsigned long WiFiSupervisorClass::backoff(int failures)
+{
+	unsigned long delay = BASE_DELAY;
+
+	while ((failures-- > 0) && (delay < MAX_DELAY))
+	{
+		delay *= 2;
+	}
+
+	if (delay > MAX_DELAY)
+	{
+		delay = MAX_DELAY;
+	}
+
+	return delay / 2 + esp_random() % (delay / 2 + 1);
+}
+
+/// <summary>
+///  Returns the name of a supervisor state.
+/// </summary>
+/// <param name="state">The state</param>
+/// <returns>The state name</returns>
+const char* WiFiSupervisorClass::name(State state)
+{
+	switch (state)
+	{
+	case Connected: return "Connected";
+	case Waiting: return "Waiting";
+	case Connecting: return "Connecting";
+	default: return "Idle";
+	}
+}
+
+/// <summary>
+///  Serialize the WiFiSupervisorClass instance data to a JSON string.
+/// </summary>
+/// <returns>The JSON string</returns>
+String WiFiSupervisorClass::serialize()
+{
+	const int capacity = JSON_OBJECT_SIZE(13);
+	StaticJsonDocument<capacity> doc;
+	String json;
+
+	lock.lock();
+	State status = Status;
+	int budget = Budget;
+	int failures = Failures;
+	unsigned long backoffDelay = Delay;
+	uint32_t disconnects = Disconnects;
+	uint32_t lostIPs = LostIPs;
+	uint32_t outages = Outages;
+	uint32_t attempts = Attempts;
+	uint32_t reconnects = Reconnects;
+	unsigned long start = outage;
+	unsigned long lastOutage = LastOutage;
+	unsigned long longestOutage = LongestOutage;
+	unsigned long totalOutage = TotalOutage;
+	lock.unlock();
+
+	doc["Status"] = name(status);
+	doc["Budget"] = budget;
+	doc["Failures"] = failures;
+	doc["Delay"] = backoffDelay;
+	doc["Disconnects"] = disconnects;
+	doc["LostIPs"] = lostIPs;
+	doc["Outages"] = outages;
+	doc["Attempts"] = attempts;
+	doc["Reconnects"] = reconnects;
+	doc["Outage"] = (start != 0) ? millis() - start : 0;
+	doc["LastOutage"] = lastOutage;
+	doc["LongestOutage"] = longestOutage;
+	doc["TotalOutage"] = totalOutage;
+
+	serializeJsonPretty(doc, json);
+
+	return json;
+}
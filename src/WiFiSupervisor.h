@@ -0,0 +1,90 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="WiFiSupervisor.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <Arduino.h>
+
+#include "SnapshotLock.h"
+
+/// <summary>
+/// This class supervises the WiFi station connection. A lost connection (disconnect or lost IP event)
+/// is reconnected with a jittered exponential backoff while the access point stays up. The chip is
+/// only restarted after a number of failed attempts in a row during an outage (the failure budget, 0 = never).
+/// The events are flagged by the WiFi event task, the state machine is advanced by the main task
+/// which performs the returned action. The statistics are copied by the handlers under a lock (see /supervisor).
+/// </summary>
+class WiFiSupervisorClass
+{
+public:
+	static const unsigned long BASE_DELAY = 1000;			// The delay before the first attempt (msec)
+	static const unsigned long MAX_DELAY = 60000;			// The maximum delay between attempts (msec)
+	static const unsigned long CONNECT_TIMEOUT = 15000;		// The maximum time of an attempt (msec)
+	static const int DEFAULT_BUDGET = 20;					// The default failure budget (attempts)
+
+	/// <summary>
+	/// The supervisor states.
+	/// </summary>
+	enum State
+	{
+		Idle,									// No network configured
+		Connected,								// Connected (IP address assigned)
+		Waiting,								// Waiting for the next attempt (backoff)
+		Connecting								// Attempting to connect
+	};
+
+	/// <summary>
+	/// The actions to be performed by the main task.
+	/// </summary>
+	enum Action
+	{
+		None,									// Nothing to do
+		Reconnect,								// Start connecting (see beginWiFi)
+		Restart									// The failure budget is exhausted
+	};
+
+private:
+	static const uint8_t EVENT_DISCONNECTED = 0x01;		// SYSTEM_EVENT_STA_DISCONNECTED
+	static const uint8_t EVENT_LOST_IP = 0x02;			// SYSTEM_EVENT_STA_LOST_IP
+
+	std::atomic<uint8_t> events;				// The pending events (set by the event task)
+	SnapshotLock lock;							// Guards the state read by the handlers
+	unsigned long next = 0;						// The time of the next attempt (msec)
+	unsigned long attempt = 0;					// The start of the current attempt (msec)
+	unsigned long outage = 0;					// The start of the current outage (0 if none)
+
+	void lost(unsigned long now);				// Starts an outage
+	void restored(unsigned long now);			// Ends an outage
+	static unsigned long backoff(int failures);	// Returns the jittered delay
+
+public:
+	State Status = Idle;						// The current state
+	int Budget = DEFAULT_BUDGET;				// The failure budget (0 = never restart)
+	int Failures = 0;							// The number of failed attempts in a row
+	unsigned long Delay = 0;					// The current backoff delay (msec)
+	uint32_t Disconnects = 0;					// The number of disconnect events
+	uint32_t LostIPs = 0;						// The number of lost IP events
+	uint32_t Outages = 0;						// The number of outages
+	uint32_t Attempts = 0;						// The number of reconnect attempts
+	uint32_t Reconnects = 0;					// The number of restored connections
+	unsigned long LastOutage = 0;				// The duration of the last outage (msec)
+	unsigned long LongestOutage = 0;			// The duration of the longest outage (msec)
+	unsigned long TotalOutage = 0;				// The total duration of all outages (msec)
+
+	WiFiSupervisorClass();
+
+	void begin(bool enabled, int budget = DEFAULT_BUDGET);	// Starts supervising (a connection is being established)
+	void disconnected();						// Flags a disconnect event (event task)
+	void lostIP();								// Flags a lost IP event (event task)
+	Action update(bool connected);				// Advances the state machine (main task)
+
+	static const char* name(State state);		// Returns the name of the state
+
+	String serialize();							// Return a string serialization (JSON)
+};
@@ -0,0 +1,83 @@
+# ----------------------------------------------------------------------------------------------------------------------
+# <copyright file="bundle.py" company="DTV-Online">
+#   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+# </copyright>
+# <license>
+#   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+# </license>
+# ----------------------------------------------------------------------------------------------------------------------
+"""
+Concatenates the script and style sheet sources listed in assets/bundle.json into single bundles in data/
+(in manifest order), and updates the content hash in the bundle URLs of the data/*.html pages.
+Run before uploading the SPIFFS image:
+
+    python3 tools/bundle.py
+"""
+import hashlib
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ASSETS = os.path.join(ROOT, 'assets')
+DATA = os.path.join(ROOT, 'data')
+
+# Source map references are dropped (the maps are not served).
+SOURCE_MAP = re.compile(rb'^\s*(//[#@] sourceMappingURL=.*|/\*[#@] sourceMappingURL=.*\*/)\s*$', re.MULTILINE)
+
+
+def build(target, sources):
+    """Concatenates the sources, writes the bundle and returns the short content hash."""
+    parts = []
+
+    for source in sources:
+        with open(os.path.join(ASSETS, source), 'rb') as f:
+            text = SOURCE_MAP.sub(b'', f.read()).rstrip()
+
+        # Terminate every script so that concatenated modules cannot run into each other.
+        if target.endswith('.js') and not text.endswith(b';'):
+            text += b';'
+
+        parts.append(b'/* ' + source.encode() + b' */\n' + text + b'\n')
+
+    bundle = b''.join(parts)
+
+    with open(os.path.join(DATA, target), 'wb') as f:
+        f.write(bundle)
+
+    digest = hashlib.sha256(bundle).hexdigest()[:8]
+    print('%-20s %8d bytes  %s  (%d files)' % (target, len(bundle), digest, len(sources)))
+    return digest
+
+
+def main():
+    with open(os.path.join(ASSETS, 'bundle.json')) as f:
+        manifest = json.load(f)
+
+    hashes = {target: build(target, sources) for target, sources in manifest.items()}
+
+    for name in sorted(os.listdir(DATA)):
+        if not name.endswith('.html'):
+            continue
+
+        path = os.path.join(DATA, name)
+
+        with open(path, encoding='utf-8-sig') as f:
+            html = f.read()
+
+        updated = html
+
+        for target, digest in hashes.items():
+            updated = re.sub(r'/' + re.escape(target) + r'\?v=[0-9a-f]*', '/%s?v=%s' % (target, digest), updated)
+
+        if updated != html:
+            with open(path, 'w', encoding='utf-8-sig', newline='') as f:
+                f.write(updated)
+            print('updated %s' % name)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
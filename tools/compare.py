@@ -0,0 +1,64 @@
+# ----------------------------------------------------------------------------------------------------------------------
+# <copyright file="compare.py" company="DTV-Online">
+#   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+# </copyright>
+# <license>
+#   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+# </license>
+# ----------------------------------------------------------------------------------------------------------------------
+"""
+Compares the response size and latency of the JSON endpoints in JSON and MessagePack format.
+
+    python3 tools/compare.py [host] [count]
+
+The host defaults to knoblomat.local, every endpoint is requested count times (default 20) per format.
+"""
+import statistics
+import sys
+import time
+import urllib.error
+import urllib.request
+
+ENDPOINTS = ['/settings', '/system', '/ap', '/wifi', '/server', '/game']
+FORMATS = [('json', 'application/json'), ('msgpack', 'application/msgpack')]
+
+
+def fetch(url, accept):
+    """Returns the response size (bytes) and latency (msec) of a single GET request."""
+    request = urllib.request.Request(url, headers={'Accept': accept})
+    start = time.perf_counter()
+
+    with urllib.request.urlopen(request, timeout=10) as response:
+        body = response.read()
+
+    return len(body), (time.perf_counter() - start) * 1000.0
+
+
+def main():
+    host = sys.argv[1] if len(sys.argv) > 1 else 'knoblomat.local'
+    count = int(sys.argv[2]) if len(sys.argv) > 2 else 20
+
+    print('%-10s %8s %8s %7s %10s %10s' % ('endpoint', 'json', 'msgpack', 'size', 'json ms', 'msgpack ms'))
+
+    for endpoint in ENDPOINTS:
+        results = {}
+
+        try:
+            for name, accept in FORMATS:
+                samples = [fetch('http://%s%s' % (host, endpoint), accept) for _ in range(count)]
+                results[name] = (samples[0][0], statistics.median(latency for _, latency in samples))
+        except urllib.error.URLError as error:
+            print('%-10s %s' % (endpoint, error))
+            continue
+
+        json_size, json_ms = results['json']
+        msgpack_size, msgpack_ms = results['msgpack']
+
+        print('%-10s %8d %8d %6.0f%% %10.1f %10.1f' % (endpoint, json_size, msgpack_size,
+                                                       100.0 * msgpack_size / json_size, json_ms, msgpack_ms))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
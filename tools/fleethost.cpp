@@ -0,0 +1,89 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="fleethost.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+// Runs a simulated Knoblomat on the host using the fleet gossip of src/Fleet.cpp (see FleetClass).
+// Start several instances on one host, each plays random games and prints the fleet leaderboard.
+//
+//     g++ -std=gnu++11 -O2 -Isrc tools/fleethost.cpp src/Fleet.cpp -o fleethost
+//     ./fleethost alpha & ./fleethost bravo & ./fleethost charlie
+//
+// Options: fleethost name [seconds] [games per minute]
+// --------------------------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+
+#include "Fleet.h"
+
+int main(int argc, char* argv[])
+{
+	const char* name = (argc > 1) ? argv[1] : "knoblomat";
+	int seconds = (argc > 2) ? atoi(argv[2]) : 60;
+	int rate = (argc > 3) ? atoi(argv[3]) : 30;
+
+	srand((unsigned)time(NULL) ^ (unsigned)getpid());
+
+	uint32_t node = ((uint32_t)getpid() << 16) ^ (uint32_t)rand();
+	SocketFleetTransport transport;
+	FleetClass fleet;
+	FleetScore score = { 0, 0, 0 };
+
+	if (!fleet.begin(&transport, node, name))
+	{
+		fprintf(stderr, "%s: cannot join the multicast group\n", name);
+		return 1;
+	}
+
+	uint32_t start = FleetClass::now();
+	uint32_t printed = start;
+
+	while (FleetClass::now() - start < (uint32_t)seconds * 1000)
+	{
+		// Play a game with the given rate (polled every 10 msec).
+		if (rand() % 6000 < rate)
+		{
+			switch (rand() % 3)
+			{
+			case 0: ++score.Ties; break;
+			case 1: ++score.Wins; break;
+			default: ++score.Losses; break;
+			}
+		}
+
+		fleet.update(score);
+
+		if (FleetClass::now() - printed >= 5000)
+		{
+			FleetPeer entries[FleetClass::MAX_PEERS + 1];
+			int count = fleet.leaderboard(entries, FleetClass::MAX_PEERS + 1);
+			FleetScore total = fleet.total(entries, count);
+
+			printf("%s: %d devices, fleet %u/%u/%u (ties/wins/losses), sent %u (%u bytes), received %u (%u deltas, %u dropped)\n",
+				name, count, total.Ties, total.Wins, total.Losses,
+				fleet.Sent, fleet.BytesSent, fleet.Received, fleet.Deltas, fleet.Dropped);
+
+			for (int i = 0; i < count; ++i)
+			{
+				in_addr address = { entries[i].Address };
+				printf("  %2d. %-15s %-15s %6u %6u %6u%s\n", i + 1, entries[i].Name,
+					(entries[i].Address != 0) ? inet_ntoa(address) : "local",
+					entries[i].Score.Wins, entries[i].Score.Ties, entries[i].Score.Losses,
+					entries[i].Stale ? " (stale)" : "");
+			}
+
+			fflush(stdout);
+			printed = FleetClass::now();
+		}
+
+		usleep(10000);
+	}
+
+	return 0;
+}
@@ -0,0 +1,55 @@
+# ----------------------------------------------------------------------------------------------------------------------
+# <copyright file="fsbench.py" company="DTV-Online">
+#   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+# </copyright>
+# <license>
+#   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+# </license>
+# ----------------------------------------------------------------------------------------------------------------------
+"""
+Runs the file system benchmark on one or more devices (e.g. one built with SPIFFS and one with LittleFS,
+see src/FileSystem.h) and prints the results side by side.
+
+    python3 tools/fsbench.py host [host ...]
+"""
+import json
+import sys
+import time
+import urllib.request
+
+ROWS = [
+    ('Backend', 'Backend', ''),
+    ('MountTime', 'Mount time', 'us'),
+    ('Files', 'Files', ''),
+    ('Bytes', 'Bytes', ''),
+    ('OpenAverage', 'Open (avg)', 'us'),
+    ('OpenMax', 'Open (max)', 'us'),
+    ('ReadTime', 'Read time', 'us'),
+    ('Throughput', 'Throughput', 'B/s'),
+]
+
+
+def run(host):
+    """Starts the benchmark on the device and returns the results."""
+    urllib.request.urlopen(urllib.request.Request('http://%s/filesystem' % host, method='POST'), timeout=10).read()
+    time.sleep(5)
+
+    with urllib.request.urlopen('http://%s/filesystem' % host, timeout=10) as response:
+        return json.loads(response.read().decode())
+
+
+def main():
+    hosts = sys.argv[1:] or ['knoblomat.local']
+    results = [run(host) for host in hosts]
+
+    print('%-12s' % '' + ''.join('%18s' % host for host in hosts))
+
+    for key, label, unit in ROWS:
+        print('%-12s' % label + ''.join('%18s' % ('%s %s' % (result.get(key, '-'), unit)).strip().rjust(18)
+                                        for result in results))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,75 @@
+# ----------------------------------------------------------------------------------------------------------------------
+# <copyright file="networks.py" company="DTV-Online">
+#   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+# </copyright>
+# <license>
+#   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+# </license>
+# ----------------------------------------------------------------------------------------------------------------------
+"""
+Checks the /networks endpoint of a Knoblomat: a JSON array is accepted (202) and saved by the main task
+(listed by GET /networks), a JSON object is rejected (400). Note that the stored networks are replaced.
+
+    python3 tools/networks.py [host] [ssid] [pass]
+
+The host defaults to knoblomat.local, the network defaults to a test entry (not connected while the
+WiFi settings network is in range).
+"""
+import json
+import sys
+import time
+import urllib.error
+import urllib.request
+
+
+def post(url, body):
+    """Posts a JSON body and returns the status code."""
+    request = urllib.request.Request(url, data=json.dumps(body).encode(), method='POST',
+                                     headers={'Content-Type': 'application/json'})
+
+    try:
+        with urllib.request.urlopen(request, timeout=10) as response:
+            response.read()
+            return response.status
+    except urllib.error.HTTPError as error:
+        return error.code
+
+
+def listed(url, ssid, timeout=5.0):
+    """Returns True if the network is listed by GET /networks within the timeout (sec)."""
+    deadline = time.time() + timeout
+
+    while time.time() < deadline:
+        with urllib.request.urlopen(url, timeout=10) as response:
+            if any(entry.get('SSID') == ssid for entry in json.load(response)):
+                return True
+
+        time.sleep(0.5)
+
+    return False
+
+
+def check(name, ok):
+    """Prints a check result and returns it."""
+    print('%-40s %s' % (name, 'ok' if ok else 'FAILED'))
+    return ok
+
+
+def main():
+    host = sys.argv[1] if len(sys.argv) > 1 else 'knoblomat.local'
+    ssid = sys.argv[2] if len(sys.argv) > 2 else 'knoblomat-test'
+    password = sys.argv[3] if len(sys.argv) > 3 else ''
+    url = 'http://%s/networks' % host
+    network = {'SSID': ssid, 'PASS': password, 'Priority': 1}
+
+    results = [
+        check('POST array (202)', post(url, [network]) == 202),
+        check('GET lists the posted network', listed(url, ssid)),
+        check('POST object (400)', post(url, network) == 400),
+    ]
+
+    return 0 if all(results) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
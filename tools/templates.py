@@ -0,0 +1,164 @@
+# ----------------------------------------------------------------------------------------------------------------------
+# <copyright file="templates.py" company="DTV-Online">
+#   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+# </copyright>
+# <license>
+#   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+# </license>
+# ----------------------------------------------------------------------------------------------------------------------
+"""
+Compiles the {{Name}} placeholders of the data/*.html pages into segment tables (src/Templates.h).
+Every segment is a static span of the page file (offset, length) followed by a placeholder ID.
+The pages are uploaded unchanged; the firmware streams the static spans from the file and renders
+the placeholders (see TemplateRendererClass). Pages without placeholders are skipped.
+Run after tools/bundle.py (which updates the pages) and before building the firmware:
+
+    python3 tools/templates.py
+"""
+import os
+import re
+import sys
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DATA = os.path.join(ROOT, 'data')
+TARGET = os.path.join(ROOT, 'src', 'Templates.h')
+
+PLACEHOLDER = re.compile(rb'\{\{([A-Za-z][A-Za-z0-9]*)\}\}')
+MAX_SPAN = 0xFFFF
+
+HEADER = '''// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="Templates.h" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+// Generated by tools/templates.py from data/*.html - do not edit.
+#pragma once
+
+#include <stdint.h>
+
+/// <summary>
+/// The template placeholders (values ending in Json are escaped for a script, all others as HTML text).
+/// </summary>
+enum class Placeholder : uint8_t
+{
+	None,
+%s
+};
+
+/// <summary>
+/// A static span of the page file followed by a placeholder (None for the last segment).
+/// </summary>
+struct TemplateSegment
+{
+	uint32_t Offset;						// The offset of the static span
+	uint16_t Length;						// The length of the static span
+	Placeholder Id;							// The placeholder following the span
+};
+
+/// <summary>
+/// A compiled page (the size and CRC-32 detect a page changed after compiling).
+/// </summary>
+struct PageTemplate
+{
+	const char* Path;						// The page file
+	uint32_t Size;							// The page size
+	uint32_t CRC;							// The CRC-32 of the page
+	const TemplateSegment* Segments;		// The segments
+	uint16_t Count;							// The number of segments
+};
+'''
+
+
+def compile_page(data):
+    """Splits the page into (offset, length, placeholder) segments."""
+    segments = []
+    start = 0
+
+    for match in PLACEHOLDER.finditer(data):
+        segments.append((start, match.start() - start, match.group(1).decode()))
+        start = match.end()
+
+    segments.append((start, len(data) - start, None))
+
+    # Split spans exceeding the 16 bit length (without placeholder).
+    result = []
+
+    for offset, length, name in segments:
+        while length > MAX_SPAN:
+            result.append((offset, MAX_SPAN, None))
+            offset += MAX_SPAN
+            length -= MAX_SPAN
+        result.append((offset, length, name))
+
+    # The segment table stores the span length as uint16_t and the offset as uint32_t.
+    for offset, length, _ in result:
+        assert 0 <= length <= MAX_SPAN, 'span of %d bytes at %d exceeds uint16_t' % (length, offset)
+        assert 0 <= offset <= 0xFFFFFFFF, 'span offset %d exceeds uint32_t' % offset
+
+    assert len(result) <= 0xFFFF, 'too many segments (%d)' % len(result)
+    return result
+
+
+def main():
+    pages = []
+    names = []
+
+    for name in sorted(os.listdir(DATA)):
+        if not name.endswith('.html'):
+            continue
+
+        with open(os.path.join(DATA, name), 'rb') as f:
+            data = f.read()
+
+        if not PLACEHOLDER.search(data):
+            continue
+
+        segments = compile_page(data)
+
+        for _, _, placeholder in segments:
+            if placeholder is not None and placeholder not in names:
+                names.append(placeholder)
+
+        pages.append((name, len(data), zlib.crc32(data) & 0xFFFFFFFF, segments))
+        print('%-12s %6d bytes  %3d placeholders' % (name, len(data), sum(1 for s in segments if s[2])))
+
+    lines = [HEADER % ',\n'.join('\t%s' % name for name in names)]
+
+    for name, size, crc, segments in pages:
+        symbol = re.sub(r'\W', '_', name).upper()
+        lines.append('static const TemplateSegment %s_SEGMENTS[] = {' % symbol)
+
+        for offset, length, placeholder in segments:
+            lines.append('\t{ %d, %d, Placeholder::%s },' % (offset, length, placeholder or 'None'))
+
+        lines.append('};\n')
+
+    lines.append('static const PageTemplate TEMPLATES[] = {')
+
+    for name, size, crc, segments in pages:
+        symbol = re.sub(r'\W', '_', name).upper()
+        lines.append('\t{ "/%s", %d, 0x%08X, %s_SEGMENTS, %d },' % (name, size, crc, symbol, len(segments)))
+
+    lines.append('};\n')
+    lines.append('static const int TEMPLATE_COUNT = %d;\n' % len(pages))
+    lines.append('static const char* const PLACEHOLDER_NAMES[] = {')
+    lines.append('\t"None",')
+
+    for name in names:
+        lines.append('\t"%s",' % name)
+
+    lines.append('};')
+
+    with open(TARGET, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+    print('wrote %s (%d pages, %d placeholders)' % (os.path.relpath(TARGET, ROOT), len(pages), len(names)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,362 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="tournament.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+// Runs rock-paper-scissors tournaments on the host using the rules of src/Rules.h (see RulesClass).
+// Every pairing of a player and a machine strategy plays the given number of rounds, split into
+// independent matches running in parallel (one thread per core, each with its own random generator).
+// The win/tie/loss rates of the player are printed with 95% confidence intervals (Wilson score).
+//
+//     g++ -std=gnu++11 -O2 -pthread -Isrc tools/tournament.cpp -o tournament
+//     ./tournament -r 10000000 -p random,frequency -m random,cycle
+//
+// Options: -r rounds per pairing, -t threads, -s seed, -p player strategies, -m machine strategies, -l (list)
+// --------------------------------------------------------------------------------------------------------------------
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Rules.h"
+
+/// <summary>
+/// A strategy choosing the next hand (a new instance per match, used by a single thread).
+/// </summary>
+class Strategy
+{
+public:
+	virtual ~Strategy() {}
+
+	virtual Hand next(std::mt19937_64& random) = 0;			// Chooses the next hand
+	virtual void observe(Hand /*own*/, Hand /*other*/) {}	// Receives the hands of the last round
+};
+
+/// <summary>
+/// Plays a uniformly random hand (the machine of the game page).
+/// </summary>
+class RandomStrategy : public Strategy
+{
+public:
+	Hand next(std::mt19937_64& random) override
+	{
+		return RulesClass::hand((int)(random() % RulesClass::HANDS));
+	}
+};
+
+/// <summary>
+/// Always plays rock.
+/// </summary>
+class RockStrategy : public Strategy
+{
+public:
+	Hand next(std::mt19937_64& /*random*/) override
+	{
+		return Hand::Rock;
+	}
+};
+
+/// <summary>
+/// Plays rock, scissors, paper in turn.
+/// </summary>
+class CycleStrategy : public Strategy
+{
+private:
+	int index = 0;
+
+public:
+	Hand next(std::mt19937_64& /*random*/) override
+	{
+		return RulesClass::hand(index++ % RulesClass::HANDS);
+	}
+};
+
+/// <summary>
+/// Plays the hand beating the last hand of the opponent (random in the first round).
+/// </summary>
+class BeatLastStrategy : public Strategy
+{
+private:
+	Hand last = Hand::Rock;
+	bool seen = false;
+
+public:
+	Hand next(std::mt19937_64& random) override
+	{
+		return seen ? RulesClass::beat(last) : RulesClass::hand((int)(random() % RulesClass::HANDS));
+	}
+
+	void observe(Hand /*own*/, Hand other) override
+	{
+		last = other;
+		seen = true;
+	}
+};
+
+/// <summary>
+/// Keeps the hand after a win, otherwise switches to the hand beating the own last hand.
+/// </summary>
+class WinStayStrategy : public Strategy
+{
+private:
+	Hand hand = Hand::Rock;
+
+public:
+	Hand next(std::mt19937_64& /*random*/) override
+	{
+		return hand;
+	}
+
+	void observe(Hand own, Hand other) override
+	{
+		hand = (RulesClass::play(own, other) == Outcome::Win) ? own : RulesClass::beat(own);
+	}
+};
+
+/// <summary>
+/// Plays the hand beating the most frequent hand of the opponent (ties resolved randomly).
+/// </summary>
+class FrequencyStrategy : public Strategy
+{
+private:
+	uint64_t counts[RulesClass::HANDS] = {};
+
+public:
+	Hand next(std::mt19937_64& random) override
+	{
+		int best = (int)(random() % RulesClass::HANDS);
+
+		for (int i = 0; i < RulesClass::HANDS; ++i)
+		{
+			if (counts[i] > counts[best])
+			{
+				best = i;
+			}
+		}
+
+		return RulesClass::beat(RulesClass::hand(best));
+	}
+
+	void observe(Hand /*own*/, Hand other) override
+	{
+		++counts[(int)other - 1];
+	}
+};
+
+/// <summary>
+/// The registered strategies (usable as player and as machine).
+/// </summary>
+struct StrategyInfo
+{
+	const char* Name;
+	const char* Description;
+	Strategy* (*Create)();
+};
+
+static const StrategyInfo STRATEGIES[] = {
+	{ "random", "uniformly random hand (the game page)", []() -> Strategy* { return new RandomStrategy(); } },
+	{ "rock", "always rock", []() -> Strategy* { return new RockStrategy(); } },
+	{ "cycle", "rock, scissors, paper in turn", []() -> Strategy* { return new CycleStrategy(); } },
+	{ "beatlast", "beats the last hand of the opponent", []() -> Strategy* { return new BeatLastStrategy(); } },
+	{ "winstay", "keeps a winning hand, switches otherwise", []() -> Strategy* { return new WinStayStrategy(); } },
+	{ "frequency", "beats the most frequent hand of the opponent", []() -> Strategy* { return new FrequencyStrategy(); } },
+};
+
+static const int STRATEGY_COUNT = sizeof(STRATEGIES) / sizeof(STRATEGIES[0]);
+
+/// <summary>
+/// The outcome counts of a match (seen from the player).
+/// </summary>
+struct MatchResult
+{
+	uint64_t Wins;
+	uint64_t Ties;
+	uint64_t Losses;
+};
+
+/// <summary>
+/// Plays a match of the given number of rounds.
+/// </summary>
+static MatchResult play(const StrategyInfo& player, const StrategyInfo& machine, uint64_t rounds, uint64_t seed)
+{
+	std::mt19937_64 random(seed);
+	std::unique_ptr<Strategy> p(player.Create());
+	std::unique_ptr<Strategy> m(machine.Create());
+	MatchResult result = { 0, 0, 0 };
+
+	for (uint64_t round = 0; round < rounds; ++round)
+	{
+		Hand a = p->next(random);
+		Hand b = m->next(random);
+
+		switch (RulesClass::play(a, b))
+		{
+		case Outcome::Win: ++result.Wins; break;
+		case Outcome::Tie: ++result.Ties; break;
+		default: ++result.Losses; break;
+		}
+
+		p->observe(a, b);
+		m->observe(b, a);
+	}
+
+	return result;
+}
+
+/// <summary>
+/// Returns the 95% confidence interval (Wilson score) of a rate.
+/// </summary>
+static void interval(uint64_t count, uint64_t total, double& low, double& high)
+{
+	const double z = 1.959964;
+	double n = (double)total;
+	double p = (double)count / n;
+	double center = (p + z * z / (2 * n)) / (1 + z * z / n);
+	double margin = (z / (1 + z * z / n)) * sqrt(p * (1 - p) / n + z * z / (4 * n * n));
+
+	low = (center - margin > 0) ? center - margin : 0;
+	high = (center + margin < 1) ? center + margin : 1;
+}
+
+/// <summary>
+/// Finds the strategies of a comma separated list (all if empty).
+/// </summary>
+static bool parse(const char* list, std::vector<int>& selected)
+{
+	std::string names = (list != NULL) ? list : "";
+	size_t start = 0;
+
+	if (names.empty())
+	{
+		for (int i = 0; i < STRATEGY_COUNT; ++i) selected.push_back(i);
+		return true;
+	}
+
+	while (start <= names.size())
+	{
+		size_t end = names.find(',', start);
+		if (end == std::string::npos) end = names.size();
+		std::string name = names.substr(start, end - start);
+		int index = -1;
+
+		for (int i = 0; i < STRATEGY_COUNT; ++i)
+		{
+			if (name == STRATEGIES[i].Name) index = i;
+		}
+
+		if (index < 0)
+		{
+			fprintf(stderr, "unknown strategy: %s\n", name.c_str());
+			return false;
+		}
+
+		selected.push_back(index);
+		start = end + 1;
+	}
+
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	uint64_t rounds = 1000000;
+	unsigned threads = std::thread::hardware_concurrency();
+	uint64_t seed = (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+	const char* players = NULL;
+	const char* machines = "random";
+	int option;
+
+	while ((option = getopt(argc, argv, "r:t:s:p:m:l")) != -1)
+	{
+		switch (option)
+		{
+		case 'r': rounds = strtoull(optarg, NULL, 10); break;
+		case 't': threads = (unsigned)atoi(optarg); break;
+		case 's': seed = strtoull(optarg, NULL, 10); break;
+		case 'p': players = optarg; break;
+		case 'm': machines = optarg; break;
+		case 'l':
+			for (int i = 0; i < STRATEGY_COUNT; ++i)
+			{
+				printf("%-10s %s\n", STRATEGIES[i].Name, STRATEGIES[i].Description);
+			}
+
+			return 0;
+		default:
+			fprintf(stderr, "usage: %s [-r rounds] [-t threads] [-s seed] [-p players] [-m machines] [-l]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	std::vector<int> p;
+	std::vector<int> m;
+
+	if (!parse(players, p) || !parse(machines, m) || (rounds == 0))
+	{
+		return 1;
+	}
+
+	if (threads == 0) threads = 1;
+
+	printf("%llu rounds per pairing, %u threads, seed %llu\n\n", (unsigned long long)rounds, threads, (unsigned long long)seed);
+	printf("%-10s %-10s %22s %22s %22s %12s\n", "player", "machine", "win % (95% CI)", "tie % (95% CI)", "loss % (95% CI)", "rounds/s");
+
+	for (int player : p)
+	{
+		for (int machine : m)
+		{
+			std::vector<MatchResult> results(threads);
+			std::vector<std::thread> workers;
+			auto start = std::chrono::steady_clock::now();
+
+			// Every thread plays an independent match with its own generator (seeded per pairing and thread).
+			for (unsigned t = 0; t < threads; ++t)
+			{
+				uint64_t share = rounds / threads + ((t < rounds % threads) ? 1 : 0);
+				uint64_t stream = seed ^ (((uint64_t)player << 48) | ((uint64_t)machine << 32) | t);
+
+				workers.push_back(std::thread([&results, &player, &machine, t, share, stream]() {
+					results[t] = play(STRATEGIES[player], STRATEGIES[machine], share, stream);
+				}));
+			}
+
+			MatchResult total = { 0, 0, 0 };
+
+			for (unsigned t = 0; t < threads; ++t)
+			{
+				workers[t].join();
+				total.Wins += results[t].Wins;
+				total.Ties += results[t].Ties;
+				total.Losses += results[t].Losses;
+			}
+
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			uint64_t counts[] = { total.Wins, total.Ties, total.Losses };
+			char columns[3][32];
+
+			for (int i = 0; i < 3; ++i)
+			{
+				double low, high;
+				interval(counts[i], rounds, low, high);
+				snprintf(columns[i], sizeof(columns[i]), "%.3f (%.3f-%.3f)", 100.0 * counts[i] / rounds, 100.0 * low, 100.0 * high);
+			}
+
+			printf("%-10s %-10s %22s %22s %22s %12.0f\n", STRATEGIES[player].Name, STRATEGIES[machine].Name,
+				columns[0], columns[1], columns[2], rounds / seconds);
+			fflush(stdout);
+		}
+	}
+
+	return 0;
+}
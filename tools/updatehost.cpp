@@ -0,0 +1,159 @@
+// --------------------------------------------------------------------------------------------------------------------
+// <copyright file="updatehost.cpp" company="DTV-Online">
+//   Copyright(c) 2019 Dr. Peter Trimmel. All rights reserved.
+// </copyright>
+// <license>
+//   Licensed under the MIT license. See the LICENSE file in the project root for more information.
+// </license>
+// --------------------------------------------------------------------------------------------------------------------
+// Streams an update image through src/UpdateStream.cpp on the host (see UpdateStreamClass), using the
+// file backed partition writer. The image is sent in random sized chunks (like the TCP segments of an
+// upload) and the results of a good digest, a bad digest, a short image and a missing digest are checked.
+//
+//     g++ -std=gnu++11 -O2 -Wall -Wextra -Isrc tools/updatehost.cpp src/UpdateStream.cpp -lmbedcrypto -o updatehost
+//     ./updatehost
+//
+// The digests are computed with mbedtls (as on the ESP32), so the mbedtls development package is required
+// (libmbedtls-dev on Debian/Ubuntu, which provides the headers and libmbedcrypto).
+//
+// Options: updatehost [image size] [seed]
+// --------------------------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "UpdateStream.h"
+
+static const char* TARGET = "updatehost.bin";					// The file standing in for the partition
+
+/// <summary>
+///  Formats a digest as a hex string.
+/// </summary>
+static void hex(const uint8_t* digest, size_t size, char* text)
+{
+	for (size_t i = 0; i < size; i++)
+	{
+		sprintf(text + 2 * i, "%02x", digest[i]);
+	}
+}
+
+/// <summary>
+///  Reads the target file (empty if missing).
+/// </summary>
+static std::vector<uint8_t> readTarget()
+{
+	std::vector<uint8_t> data;
+	FILE* file = fopen(TARGET, "rb");
+
+	if (file != nullptr)
+	{
+		uint8_t buffer[4096];
+		size_t len;
+
+		while ((len = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		{
+			data.insert(data.end(), buffer, buffer + len);
+		}
+
+		fclose(file);
+	}
+
+	return data;
+}
+
+/// <summary>
+///  Streams the first length bytes of an image in random sized chunks (1 to 1460 bytes).
+/// </summary>
+/// <returns>True if the update has been verified and activated</returns>
+static bool stream(const std::vector<uint8_t>& image, size_t length, const char* md5, const char* sha256, std::mt19937& random)
+{
+	UpdateStreamClass update;
+	FilePartitionWriter writer(TARGET);
+	std::uniform_int_distribution<size_t> chunk(1, 1460);
+	size_t offset = 0;
+
+	if (update.begin(&writer, image.size(), md5, sha256))
+	{
+		while ((offset < length) && (update.Status == UpdateStreamClass::Running))
+		{
+			size_t len = std::min(chunk(random), length - offset);
+			update.write(image.data() + offset, len);
+			offset += len;
+		}
+
+		update.end();
+	}
+
+	printf("    %-8s %-26s %8zu bytes  %s\n", (update.Status == UpdateStreamClass::Done) ? "Done" : "Failed",
+		update.Error, update.Written, (access("updatehost.bin.new", F_OK) == 0) ? "(temporary file left)" : "");
+
+	return update.Status == UpdateStreamClass::Done;
+}
+
+/// <summary>
+///  Prints a check result.
+/// </summary>
+static bool check(const char* name, bool ok)
+{
+	printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+int main(int argc, char* argv[])
+{
+	size_t size = (argc > 1) ? (size_t)atol(argv[1]) : 300000;
+	std::mt19937 random((argc > 2) ? (unsigned)atoi(argv[2]) : 42);
+	std::vector<uint8_t> image(size);
+	uint8_t digest[32];
+	char md5[33];
+	char sha256[65];
+	char bad[65];
+	bool ok = true;
+
+	for (uint8_t& byte : image)
+	{
+		byte = (uint8_t)random();
+	}
+
+	mbedtls_md5_context md5Context;
+	mbedtls_md5_init(&md5Context);
+	mbedtls_md5_starts(&md5Context);
+	mbedtls_md5_update(&md5Context, image.data(), image.size());
+	mbedtls_md5_finish(&md5Context, digest);
+	mbedtls_md5_free(&md5Context);
+	hex(digest, 16, md5);
+
+	mbedtls_sha256_context sha256Context;
+	mbedtls_sha256_init(&sha256Context);
+	mbedtls_sha256_starts(&sha256Context, 0);
+	mbedtls_sha256_update(&sha256Context, image.data(), image.size());
+	mbedtls_sha256_finish(&sha256Context, digest);
+	mbedtls_sha256_free(&sha256Context);
+	hex(digest, 32, sha256);
+
+	strcpy(bad, sha256);
+	bad[0] = (bad[0] == '0') ? '1' : '0';
+	remove(TARGET);
+
+	printf("Image: %zu bytes, SHA-256 %s\n", size, sha256);
+
+	ok &= check("Good SHA-256 and MD5 (activated)", stream(image, size, md5, sha256, random) && (readTarget() == image));
+	ok &= check("Good MD5 only (activated)", stream(image, size, md5, nullptr, random) && (readTarget() == image));
+
+	image[size / 2] ^= 0xFF;
+	ok &= check("Corrupted image (rejected)", !stream(image, size, nullptr, sha256, random));
+	image[size / 2] ^= 0xFF;
+
+	ok &= check("Bad SHA-256 (rejected)", !stream(image, size, nullptr, bad, random));
+	ok &= check("Short image (rejected)", !stream(image, size - 1000, md5, sha256, random));
+	ok &= check("No digest (rejected)", !stream(image, size, nullptr, nullptr, random));
+	ok &= check("Target kept and no temporary file", (readTarget() == image) && (access("updatehost.bin.new", F_OK) != 0));
+
+	remove(TARGET);
+
+	return ok ? 0 : 1;
+}